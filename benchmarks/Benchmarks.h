@@ -0,0 +1,112 @@
+/**
+ * @file Benchmarks.h
+ * @brief Entry points for the engine performance benchmarks
+ */
+
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Measure board generation throughput across thread counts
+ * @param args Optional arguments: [width] [height] [seed]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that every thread count produces the same board.
+ */
+int runBoardGenerationBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare recomputed and running inventory stat totals
+ * @param args Optional arguments: [iterations]
+ * @return int Exit status (0 for success)
+ */
+int runInventoryStatsBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare shared_ptr, reference and batched Combat round calls
+ * @param args Optional arguments: [fights] [passes]
+ * @return int Exit status (0 for success)
+ */
+int runCombatRoundsBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare scalar Combat rounds with the CombatBatch kernel
+ * @param args Optional arguments: [pairs] [rounds] [seed]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that both paths leave every character with the same health.
+ */
+int runCombatBatchBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare virtual race dispatch with the race-specialized combat kernels
+ * @param args Optional arguments: [copies of the 25 race pairs] [rounds]
+ * @return int Exit status (0 for success)
+ */
+int runRaceDispatchBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare the old string-compare command dispatch with the perfect-hash parser
+ * @param args Optional arguments: [iterations]
+ * @return int Exit status (0 for success)
+ */
+int runCommandParseBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Time saving and loading a full game snapshot
+ * @param args Optional arguments: [board size] [seed]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that the restored game matches and plays on identically.
+ */
+int runSnapshotBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare generating a board with opening boards on a mapped world file
+ * @param args Optional arguments: [board size] [sessions]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that mapped squares match and that changes stay per session.
+ */
+int runWorldFileBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Measure the cost of journaling commands and replay the journal
+ * @param args Optional arguments: [commands] [seed]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that the replayed game reaches the recorded state hash.
+ */
+int runJournalBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Compare bitset scans with the spatial index for nearest and range queries
+ * @param args Optional arguments: [board size] [queries]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that the index gives the same answers as the scan.
+ */
+int runSpatialQueryBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Time A* routes and distance-field queries while the board changes
+ * @param args Optional arguments: [board size] [queries]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks routes against plain BFS and repaired fields against fresh ones.
+ */
+int runPathfindingBenchmark(const std::vector<std::string>& args);
+
+/**
+ * @brief Time enemy simulation ticks on 1, 2, 4... threads
+ * @param args Optional arguments: [board size] [ticks]
+ * @return int Exit status (0 for success)
+ *
+ * Also checks that every thread count moves the enemies identically.
+ */
+int runEnemyTickBenchmark(const std::vector<std::string>& args);
+
+#endif // BENCHMARKS_H
@@ -0,0 +1,83 @@
+/**
+ * @file BoardGenerationBenchmark.cpp
+ * @brief Board generation throughput and thread scaling benchmark
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Fold the board's occupancy layer into a single fingerprint
+ * @param board Generated board
+ * @return std::uint64_t FNV-1a hash of item types and enemy races
+ */
+std::uint64_t fingerprint(const Board& board) {
+    const BoardOccupancy& occupancy = board.getOccupancy();
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::size_t cell = 0; cell < occupancy.size(); ++cell) {
+        hash = (hash ^ occupancy.getItemType(cell)) * 1099511628211ull;
+        hash = (hash ^ occupancy.getEnemyRace(cell)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+int runBoardGenerationBenchmark(const std::vector<std::string>& args) {
+    const int width = args.size() > 0 ? std::stoi(args[0]) : 2048;
+    const int height = args.size() > 1 ? std::stoi(args[1]) : 2048;
+    const std::uint64_t seed = args.size() > 2 ? std::stoull(args[2]) : 42;
+    const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    const double cells = static_cast<double>(width) * height;
+
+    std::cout << "Board generation " << width << "x" << height << ", seed " << seed << "\n";
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "ms"
+              << std::setw(18) << "cells/s" << std::setw(10) << "speedup"
+              << std::setw(15) << "teardown ms" << "\n";
+
+    double baselineSeconds = 0.0;
+    std::uint64_t expected = 0;
+    bool deterministic = true;
+
+    for (unsigned int threads = 1; ; threads *= 2) {
+        threads = std::min(threads, maxThreads);
+
+        auto board = std::make_unique<Board>(width, height);
+        auto start = std::chrono::steady_clock::now();
+        board->initializeBoard(seed, threads);
+        auto stop = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(stop - start).count();
+
+        std::uint64_t hash = fingerprint(*board);
+
+        // Destroying the board releases every square and enemy
+        start = std::chrono::steady_clock::now();
+        board.reset();
+        const double teardownSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (threads == 1) {
+            baselineSeconds = seconds;
+            expected = hash;
+        } else if (hash != expected) {
+            deterministic = false;
+        }
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(14) << std::fixed << std::setprecision(1) << seconds * 1000.0
+                  << std::setw(18) << std::setprecision(0) << cells / seconds
+                  << std::setw(9) << std::setprecision(2) << baselineSeconds / seconds << "x"
+                  << std::setw(15) << std::setprecision(1) << teardownSeconds * 1000.0 << "\n";
+
+        if (threads == maxThreads) break;
+    }
+
+    std::cout << (deterministic ? "Output identical across thread counts\n"
+                                : "ERROR: output differs between thread counts\n");
+    return deterministic ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file CombatBatchBenchmark.cpp
+ * @brief Compares scalar combat rounds with the structure-of-arrays batch kernel
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Combat.h"
+#include "CombatBatch.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+int runCombatBatchBenchmark(const std::vector<std::string>& args) {
+    const std::size_t pairs = args.size() > 0 ? std::stoul(args[0]) : 65536;
+    const long rounds = args.size() > 1 ? std::stol(args[1]) : 50;
+    const CounterRng rng(args.size() > 2 ? std::stoull(args[2]) : 7);
+
+    // Two identical arenas: one as Character objects, one as a batch.
+    // Fighters are paired off, and every eighth pair also targets its neighbour's
+    // defender so repeated defenders are exercised.
+    std::vector<std::shared_ptr<Character>> characters;
+    CombatBatch batch;
+    for (std::size_t i = 0; i < pairs * 2; ++i) {
+        std::shared_ptr<Character> character = Board::createEnemy(static_cast<Race>((i * 7 / 3) % 5));
+        if (i % 3 == 0) character->getInventory().addItem(static_cast<ItemId>(i % ItemCatalog::COUNT));
+        characters.push_back(character);
+        batch.add(*character);
+    }
+
+    std::vector<std::uint32_t> attackers(pairs);
+    std::vector<std::uint32_t> defenders(pairs);
+    for (std::size_t i = 0; i < pairs; ++i) {
+        attackers[i] = static_cast<std::uint32_t>(2 * i);
+        defenders[i] = static_cast<std::uint32_t>(i % 8 == 7 ? 2 * i - 1 : 2 * i + 1);
+    }
+
+    std::cout << "Combat batch, " << pairs << " pairs x " << rounds << " rounds\n";
+
+    long scalarGold = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long round = 0; round < rounds; ++round) {
+        const bool isDaytime = round % 2 == 0;
+        for (std::size_t i = 0; i < pairs; ++i) {
+            scalarGold += Combat::executeCombatRound(*characters[attackers[i]], *characters[defenders[i]],
+                                                     isDaytime, CombatBatch::rollFor(rng, round, i)).second;
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+
+    long batchGold = 0;
+    CombatBatch::RoundResults results;
+    for (long round = 0; round < rounds; ++round) {
+        batch.resolveRound(attackers.data(), defenders.data(), pairs, round % 2 == 0, rng, round, results);
+        for (int gold : results.gold) batchGold += gold;
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    const double total = static_cast<double>(pairs) * rounds;
+    double scalarNanos = std::chrono::duration<double, std::nano>(middle - start).count() / total;
+    double batchNanos = std::chrono::duration<double, std::nano>(stop - middle).count() / total;
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < characters.size(); ++i) {
+        const Character& character = *characters[i];
+        int baseHealth = character.getHealth() - character.getInventory().getTotalModifications().health;
+        if (baseHealth != batch.getHealth(static_cast<std::uint32_t>(i))) ++mismatches;
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(14) << "scalar" << std::setw(12) << scalarNanos << " ns/round  (gold " << scalarGold << ")\n"
+              << std::setw(14) << "batch" << std::setw(12) << batchNanos << " ns/round  (gold " << batchGold << ")\n"
+              << "Speedup: " << std::setprecision(1) << scalarNanos / batchNanos << "x\n";
+
+    bool consistent = mismatches == 0 && scalarGold == batchGold;
+    std::cout << (consistent ? "Batch results match scalar Combat\n"
+                             : "ERROR: " + std::to_string(mismatches) + " characters differ from scalar Combat\n");
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file CombatRoundsBenchmark.cpp
+ * @brief Compares one-at-a-time and batched combat round calls
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Combat.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+/**
+ * @struct Arena
+ * @brief Independent duels between alternating races, with their own generator
+ *
+ * Every path runs on a fresh arena built from the same seed, so all of them
+ * must land the same attacks and leave every character with the same health.
+ */
+struct Arena {
+    std::vector<std::unique_ptr<Character>> attackers;
+    std::vector<std::unique_ptr<Character>> defenders;
+    std::vector<Combat::CombatPair> pairs;
+    Combat combat;
+
+    Arena(long fights, std::uint64_t seed) : combat(Rng(seed)) {
+        for (long i = 0; i < fights; ++i) {
+            attackers.push_back(Board::createEnemy(static_cast<Race>(i % 5)));
+            defenders.push_back(Board::createEnemy(static_cast<Race>((i + 2) % 5)));
+            pairs.emplace_back(attackers.back().get(), defenders.back().get());
+        }
+    }
+
+    /**
+     * @brief Check that two arenas ended in the same state
+     * @param other Arena run through another path
+     * @return std::size_t Number of characters whose health differs
+     */
+    std::size_t countMismatches(const Arena& other) const {
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < pairs.size(); ++i) {
+            if (attackers[i]->getHealth() != other.attackers[i]->getHealth()) ++mismatches;
+            if (defenders[i]->getHealth() != other.defenders[i]->getHealth()) ++mismatches;
+        }
+        return mismatches;
+    }
+};
+
+/**
+ * @brief Time one pass over all fights and report nanoseconds per round
+ * @param label Name printed for the path
+ * @param rounds Total rounds executed by the pass
+ * @param pass Function running the pass and returning a checksum value
+ * @param checksum Receives the pass's checksum
+ * @return double Nanoseconds per round
+ */
+template <typename PassFn>
+double timeRounds(const char* label, long rounds, PassFn pass, long& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    checksum = pass();
+    auto stop = std::chrono::steady_clock::now();
+    double nanos = std::chrono::duration<double, std::nano>(stop - start).count() / rounds;
+
+    std::cout << std::setw(14) << label << std::setw(12) << std::fixed << std::setprecision(2)
+              << nanos << " ns/round  (checksum " << checksum << ")\n";
+    return nanos;
+}
+
+} // namespace
+
+int runCombatRoundsBenchmark(const std::vector<std::string>& args) {
+    const long fights = args.size() > 0 ? std::stol(args[0]) : 4096L;
+    const long passes = args.size() > 1 ? std::stol(args[1]) : 500L;
+    const long rounds = fights * passes;
+    const std::uint64_t seed = 42;
+
+    std::cout << "Combat rounds, " << fights << " fights x " << passes << " passes\n";
+
+    Arena single(fights, seed);
+    long singleLanded = 0;
+    double singleNanos = timeRounds("one at a time", rounds, [&]() {
+        long landed = 0;
+        for (long pass = 0; pass < passes; ++pass) {
+            for (long i = 0; i < fights; ++i) {
+                landed += single.combat.executeCombatRound(*single.attackers[i], *single.defenders[i],
+                                                           pass & 1).first;
+            }
+        }
+        return landed;
+    }, singleLanded);
+
+    Arena batched(fights, seed);
+    std::vector<Combat::RoundResult> results(batched.pairs.size());
+    long batchLanded = 0;
+    double batchNanos = timeRounds("batched", rounds, [&]() {
+        long landed = 0;
+        for (long pass = 0; pass < passes; ++pass) {
+            batched.combat.executeRounds(batched.pairs.data(), batched.pairs.size(), pass & 1, results.data());
+            for (const Combat::RoundResult& result : results) landed += result.first;
+        }
+        return landed;
+    }, batchLanded);
+
+    std::cout << "Speedup (batched vs one at a time): " << std::setprecision(2) << singleNanos / batchNanos << "x\n";
+
+    const std::size_t mismatches = single.countMismatches(batched);
+    bool consistent = mismatches == 0 && singleLanded == batchLanded;
+    std::cout << (consistent ? "Batched rounds match one-at-a-time rounds\n"
+                             : "ERROR: " + std::to_string(mismatches) +
+                                   " characters differ between batched and one-at-a-time rounds\n");
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file CommandParseBenchmark.cpp
+ * @brief Compares the old copy-and-compare command dispatch with the perfect-hash parser
+ */
+
+#include "Benchmarks.h"
+#include "CommandParser.h"
+#include <cctype>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief The dispatch Game::processCommand used before CommandParser
+ * @param command Command line
+ * @return Verb Resolved verb
+ */
+Verb legacyParse(const std::string& command) {
+    std::string lowerCommand = command;
+    for (char& c : lowerCommand) {
+        c = std::tolower(static_cast<unsigned char>(c));
+    }
+
+    std::string argument;
+    std::size_t space = lowerCommand.find(' ');
+    if (space != std::string::npos && lowerCommand.compare(0, space, "pick") != 0) {
+        argument = lowerCommand.substr(space + 1);
+        lowerCommand.erase(space);
+    }
+
+    if (lowerCommand == "north" || lowerCommand == "n") return Verb::North;
+    if (lowerCommand == "south" || lowerCommand == "s") return Verb::South;
+    if (lowerCommand == "east" || lowerCommand == "e") return Verb::East;
+    if (lowerCommand == "west" || lowerCommand == "w") return Verb::West;
+    if (lowerCommand == "pick up" || lowerCommand == "p") return Verb::PickUp;
+    if (lowerCommand == "drop" || lowerCommand == "d") return Verb::Drop;
+    if (lowerCommand == "attack" || lowerCommand == "a") return Verb::Attack;
+    if (lowerCommand == "look" || lowerCommand == "l") return Verb::Look;
+    if (lowerCommand == "inventory" || lowerCommand == "i") return Verb::Inventory;
+    if (lowerCommand == "exit" || lowerCommand == "quit") return Verb::Quit;
+    return Verb::Unknown;
+}
+
+} // namespace
+
+int runCommandParseBenchmark(const std::vector<std::string>& args) {
+    const std::size_t iterations = args.size() > 0 ? std::stoul(args[0]) : 2000000;
+
+    // A bot-like mix: mostly moves and short aliases, some long and unknown words
+    const std::vector<std::string> commands = {
+        "n", "east", "South", "w", "attack", "a", "look", "pick up", "p", "Inventory",
+        "drop Ring of Life", "d 2", "west", "NORTH", "l", "jump", "s", "e", "i", "quit"
+    };
+
+    unsigned legacySum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        legacySum += static_cast<unsigned>(legacyParse(commands[i % commands.size()]));
+    }
+    auto middle = std::chrono::steady_clock::now();
+
+    unsigned hashedSum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        hashedSum += static_cast<unsigned>(parseCommand(commands[i % commands.size()]).verb);
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double legacyNanos = std::chrono::duration<double, std::nano>(middle - start).count() / iterations;
+    double hashedNanos = std::chrono::duration<double, std::nano>(stop - middle).count() / iterations;
+
+    std::cout << "Command parsing, " << iterations << " commands\n"
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << "compare chain" << std::setw(12) << legacyNanos << " ns/command\n"
+              << std::setw(14) << "perfect hash" << std::setw(12) << hashedNanos << " ns/command\n"
+              << "Speedup: " << std::setprecision(1) << legacyNanos / hashedNanos << "x\n";
+
+    bool consistent = legacySum == hashedSum;
+    std::cout << (consistent ? "Parsed verbs match the old dispatch\n"
+                             : "ERROR: parsed verbs differ from the old dispatch\n");
+    return consistent ? 0 : 1;
+}
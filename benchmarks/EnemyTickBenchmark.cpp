@@ -0,0 +1,117 @@
+/**
+ * @file EnemyTickBenchmark.cpp
+ * @brief World tick throughput and thread scaling with about a million active enemies
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "EnemySimulation.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Fold the enemies' positions, races and health into a single fingerprint
+ * @param board Simulated board
+ * @return std::uint64_t FNV-1a hash
+ */
+std::uint64_t fingerprint(const Board& board) {
+    const BoardOccupancy& occupancy = board.getOccupancy();
+    const int width = board.getDimensions().first;
+    std::uint64_t hash = 1469598103934665603ull;
+    for (std::size_t cell = 0; cell < occupancy.size(); ++cell) {
+        if (occupancy.hasEnemy(cell)) {
+            hash = (hash ^ cell) * 1099511628211ull;
+            hash = (hash ^ occupancy.getEnemyRace(cell)) * 1099511628211ull;
+            hash = (hash ^ static_cast<std::uint64_t>(
+                board.getEnemyHealth(static_cast<int>(cell % width), static_cast<int>(cell / width)))) * 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+} // namespace
+
+int runEnemyTickBenchmark(const std::vector<std::string>& args) {
+    // 2240 x 2240 squares at a 20% enemy rate hold about a million enemies
+    const int size = args.size() > 0 ? std::stoi(args[0]) : 2240;
+    const int ticks = args.size() > 1 ? std::stoi(args[1]) : 20;
+    const std::uint64_t seed = 42;
+    const unsigned int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    // Always compare at least 4 threads with 1, even on a small machine,
+    // so the determinism check means something
+    const unsigned int lastThreads = std::max(4u, maxThreads);
+
+    std::cout << "Enemy tick on " << size << "x" << size << ", " << ticks << " ticks, "
+              << maxThreads << " hardware threads\n";
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "ms/tick" << std::setw(16) << "enemies/s"
+              << std::setw(10) << "speedup" << std::setw(10) << "steals" << "\n";
+
+    double baselineSeconds = 0.0;
+    std::uint64_t expected = 0;
+    bool consistent = true;
+
+    for (unsigned int threads = 1; ; threads *= 2) {
+        threads = std::min(threads, lastThreads);
+
+        Board board(size, size);
+        board.initializeBoard(seed, 0);
+        JobSystem jobs(threads);
+        EnemySimulation simulation(board, jobs, seed);
+
+        // Put the player in the middle and wound a few enemies so every action happens
+        for (int i = 0; i < size / 2; ++i) {
+            board.movePlayer("east");
+            board.movePlayer("south");
+        }
+        for (int y = 0; y < size; y += 7) {
+            if (board.getSquare(y % size, y)->hasEnemy()) {
+                board.setEnemyHealth(y % size, y, board.getEnemyHealth(y % size, y) - 10);
+            }
+        }
+
+        const std::size_t enemiesBefore = board.countEnemies();
+        EnemySimulation::TickStats totals;
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < ticks; ++t) {
+            const EnemySimulation::TickStats stats = simulation.tick();
+            totals.enemies += stats.enemies;
+            totals.moved += stats.moved;
+            totals.chasing += stats.chasing;
+            totals.healed += stats.healed;
+            board.incrementCommandCount(); // Day and night alternate every 5 ticks
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Enemies are never created or lost, and the index must agree with the bits
+        const BoardOccupancy& occupancy = board.getOccupancy();
+        if (board.countEnemies() != enemiesBefore || occupancy.getEnemyIndex()->count() != enemiesBefore) {
+            consistent = false;
+        }
+        const std::uint64_t hash = fingerprint(board);
+        if (threads == 1) {
+            baselineSeconds = seconds;
+            expected = hash;
+            std::cout << "  (" << enemiesBefore << " enemies; per tick " << totals.moved / ticks << " moved, "
+                      << totals.chasing / ticks << " chasing, " << totals.healed / ticks << " healed)\n";
+        } else if (hash != expected) {
+            consistent = false;
+        }
+
+        std::cout << std::setw(8) << threads << std::setw(12) << std::fixed << std::setprecision(2)
+                  << seconds * 1000.0 / ticks << std::setw(16) << std::setprecision(0)
+                  << totals.enemies / seconds << std::setw(9) << std::setprecision(2)
+                  << baselineSeconds / seconds << "x" << std::setw(10) << jobs.getSteals() << "\n";
+
+        if (threads == lastThreads) break;
+    }
+
+    std::cout << (consistent ? "Enemies identical across thread counts\n"
+                             : "ERROR: enemies differ between thread counts or were lost\n");
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file InventoryStatsBenchmark.cpp
+ * @brief Compares recomputed and incrementally maintained inventory stat totals
+ */
+
+#include "Benchmarks.h"
+#include "Inventory.h"
+#include "ItemCatalog.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+namespace {
+
+/**
+ * @brief Time a stat-reading loop and report nanoseconds per read
+ * @param label Name printed for the path
+ * @param iterations Number of reads
+ * @param read Function performing one read and returning a checksum value
+ * @return double Nanoseconds per read
+ */
+template <typename ReadFn>
+double timeReads(const char* label, long iterations, ReadFn read) {
+    long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+        checksum += read();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double nanos = std::chrono::duration<double, std::nano>(stop - start).count() / iterations;
+
+    std::cout << std::setw(14) << label << std::setw(12) << std::fixed << std::setprecision(2)
+              << nanos << " ns/read  (checksum " << checksum << ")\n";
+    return nanos;
+}
+
+} // namespace
+
+int runInventoryStatsBenchmark(const std::vector<std::string>& args) {
+    const long iterations = args.size() > 0 ? std::stol(args[0]) : 20000000L;
+
+    // A fully equipped inventory: one of each slot plus a stack of rings
+    Inventory inventory(1000);
+    inventory.addItem(ItemCatalog::SWORD);
+    inventory.addItem(ItemCatalog::PLATE_ARMOUR);
+    inventory.addItem(ItemCatalog::LARGE_SHIELD);
+    for (int i = 0; i < 4; ++i) {
+        inventory.addItem(ItemCatalog::RING_OF_LIFE);
+        inventory.addItem(ItemCatalog::RING_OF_STRENGTH);
+    }
+
+    const Inventory::ItemStats& running = inventory.getTotalModifications();
+    const Inventory::ItemStats walked = inventory.recalculateTotalModifications();
+    bool consistent = running.attack == walked.attack && running.defence == walked.defence &&
+                      running.health == walked.health && running.strength == walked.strength;
+
+    std::cout << "Inventory stat reads, " << inventory.getItemCount() << " items, "
+              << iterations << " reads of all four stats\n";
+
+    const Inventory* volatile target = &inventory; // Keep the loops from being folded away
+    double oldNanos = timeReads("recalculated", iterations, [target]() {
+        Inventory::ItemStats stats = target->recalculateTotalModifications();
+        return stats.attack + stats.defence + stats.health + stats.strength;
+    });
+    double newNanos = timeReads("running", iterations, [target]() {
+        const Inventory::ItemStats& stats = target->getTotalModifications();
+        return stats.attack + stats.defence + stats.health + stats.strength;
+    });
+
+    std::cout << "Speedup: " << std::setprecision(1) << oldNanos / newNanos << "x\n";
+    std::cout << (consistent ? "Running totals match recalculated totals\n"
+                             : "ERROR: running totals differ from recalculated totals\n");
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file JournalBenchmark.cpp
+ * @brief Measures the cost of journaling commands and checks that replay reproduces the game
+ */
+
+#include "Benchmarks.h"
+#include "CommandJournal.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+double nanosecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int runJournalBenchmark(const std::vector<std::string>& args) {
+    const std::size_t commands = args.size() > 0 ? std::stoul(args[0]) : 1000000;
+    const std::uint64_t seed = args.size() > 1 ? std::stoull(args[1]) : 42;
+    const std::string path = (std::filesystem::temp_directory_path() / "shadows-journal-bench.jrnl").string();
+
+    // Bot-like mix of moves, looks, pick-ups and fights
+    const std::vector<std::string> mix = {
+        "n", "east", "look", "p", "s", "attack", "w", "i", "e", "e", "pick up", "n", "l", "attack", "s", "w"
+    };
+
+    std::cout << "Journal of " << commands << " commands\n" << std::fixed << std::setprecision(1);
+
+    // Raw append cost, including the batched writes
+    JournalHeader header{};
+    header.width = 1;
+    header.height = 1;
+    auto start = std::chrono::steady_clock::now();
+    {
+        CommandJournal journal(path, header);
+        for (std::size_t i = 0; i < commands; ++i) {
+            journal.append(mix[i % mix.size()]);
+        }
+    }
+    const double appendNanos = nanosecondsSince(start) / commands;
+    std::cout << "  append only             " << std::setw(10) << appendNanos << " ns/command\n";
+
+    // Game::execute() with and without a journal on the same seed
+    Game plain(seed);
+    plain.initializeGame(64, 64, "human", "Bench");
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < commands; ++i) {
+        plain.execute(mix[i % mix.size()]);
+    }
+    const double plainNanos = nanosecondsSince(start) / commands;
+
+    Game recorded(seed);
+    recorded.initializeGame(64, 64, "human", "Bench");
+    recorded.recordTo(path);
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < commands; ++i) {
+        recorded.execute(mix[i % mix.size()]);
+    }
+    const double recordedNanos = nanosecondsSince(start) / commands;
+    const std::uint64_t liveHash = GameSnapshot::stateHash(recorded);
+    recorded.finishJournal();
+
+    std::cout << "  execute                 " << std::setw(10) << plainNanos << " ns/command\n"
+              << "  execute + journal       " << std::setw(10) << recordedNanos << " ns/command\n"
+              << "  journal size            " << std::setw(10)
+              << std::filesystem::file_size(path) / 1024.0 << " KiB\n";
+
+    // Replay must land on the live game's state
+    start = std::chrono::steady_clock::now();
+    const CommandJournal::ReplayResult result = CommandJournal::replay(path);
+    std::cout << "  replay                  " << std::setw(10) << nanosecondsSince(start) / commands
+              << " ns/command\n";
+    std::remove(path.c_str());
+
+    const bool matched = result.startMatched && result.mismatches == 0 && result.checkpoints == 1 &&
+                         result.commands == commands && result.finalHash == liveHash &&
+                         liveHash == GameSnapshot::stateHash(plain);
+    std::cout << (matched ? "Replay reproduces the recorded game\n" : "ERROR: replay diverged from the recorded game\n");
+    return matched ? 0 : 1;
+}
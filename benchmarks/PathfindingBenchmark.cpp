@@ -0,0 +1,163 @@
+/**
+ * @file PathfindingBenchmark.cpp
+ * @brief Times A* routes and distance-field repairs, checking both against plain BFS
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "CounterRng.h"
+#include "ItemCatalog.h"
+#include "Pathfinder.h"
+#include "RaceTraits.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+double microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Steps between two squares by plain BFS, avoiding enemies except at the destination
+ */
+std::uint32_t bfsDistance(const Board& board, int fromX, int fromY, int toX, int toY) {
+    const int width = board.getDimensions().first;
+    const BoardOccupancy& occupancy = board.getOccupancy();
+    std::vector<std::uint32_t> distance(occupancy.size(), Pathfinder::UNREACHABLE);
+    std::vector<std::size_t> queue{static_cast<std::size_t>(fromY) * width + fromX};
+    const std::size_t goal = static_cast<std::size_t>(toY) * width + toX;
+    distance[queue[0]] = 0;
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const std::size_t cell = queue[head];
+        if (cell == goal) return distance[cell];
+        const int x = static_cast<int>(cell % width);
+        const std::size_t neighbours[4] = {cell - width, cell + width, cell - 1, cell + 1};
+        const bool valid[4] = {cell >= static_cast<std::size_t>(width), cell + width < distance.size(), x > 0,
+                               x + 1 < width};
+        for (int i = 0; i < 4; ++i) {
+            const std::size_t next = neighbours[i];
+            if (valid[i] && distance[next] == Pathfinder::UNREACHABLE &&
+                (next == goal || !occupancy.hasEnemy(next))) {
+                distance[next] = distance[cell] + 1;
+                queue.push_back(next);
+            }
+        }
+    }
+    return Pathfinder::UNREACHABLE;
+}
+
+/**
+ * @brief Steps of a findPath() route, with an empty route between distinct squares as unreachable
+ */
+std::uint32_t routeLength(const std::vector<std::pair<int, int>>& path, bool samePlace) {
+    return path.empty() && !samePlace ? Pathfinder::UNREACHABLE : static_cast<std::uint32_t>(path.size());
+}
+
+} // namespace
+
+int runPathfindingBenchmark(const std::vector<std::string>& args) {
+    const int size = args.size() > 0 ? std::stoi(args[0]) : 1024;
+    const std::size_t queries = args.size() > 1 ? std::stoul(args[1]) : 1000;
+    const std::uint64_t seed = 42;
+
+    Board board(size, size);
+    board.initializeBoard(seed, 0);
+    Pathfinder pathfinder(board);
+    const CounterRng rng(seed);
+    auto randomSquare = [&rng, size](std::uint64_t counter) {
+        const CounterRng::Block roll = rng(counter);
+        return std::make_pair(static_cast<int>(CounterRng::bounded(roll[0], size)),
+                              static_cast<int>(CounterRng::bounded(roll[1], size)));
+    };
+
+    std::cout << "Board of " << size << "x" << size << " (enemies block), " << queries << " queries\n"
+              << std::fixed << std::setprecision(1);
+    std::size_t errors = 0;
+
+    // Point-to-point A*: random pairs up to 64 squares apart, and corner to corner
+    double shortMicros = 0;
+    double steps = 0;
+    for (std::size_t i = 0; i < queries; ++i) {
+        const auto from = randomSquare(1000 + i);
+        const auto offset = randomSquare(500000 + i);
+        const int toX = std::min(size - 1, from.first + offset.first % 64);
+        const int toY = std::min(size - 1, from.second + offset.second % 64);
+        auto start = std::chrono::steady_clock::now();
+        const auto path = pathfinder.findPath(from.first, from.second, toX, toY);
+        shortMicros += microsecondsSince(start);
+        steps += path.size();
+        const bool samePlace = from.first == toX && from.second == toY;
+        if (i < 20 && routeLength(path, samePlace) !=
+                          (samePlace ? 0u : bfsDistance(board, from.first, from.second, toX, toY))) {
+            ++errors;
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    const auto across = pathfinder.findPath(0, 0, size - 1, size - 1);
+    const double acrossMicros = microsecondsSince(start);
+    if (routeLength(across, false) != bfsDistance(board, 0, 0, size - 1, size - 1)) ++errors;
+    std::cout << "  A* route, up to 64 apart  " << std::setw(10) << shortMicros / queries << " us ("
+              << steps / queries << " steps)\n"
+              << "  A* route, corner to corner" << std::setw(10) << acrossMicros << " us ("
+              << across.size() << " steps)\n";
+
+    // Distance fields: the first query builds, later ones only look up
+    start = std::chrono::steady_clock::now();
+    pathfinder.distanceTo(Pathfinder::Target::Ring, 0, 0);
+    const double buildMicros = microsecondsSince(start);
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queries; ++i) {
+        const auto from = randomSquare(2000 + i);
+        steps += pathfinder.pathToNearest(Pathfinder::Target::Ring, from.first, from.second).size();
+    }
+    const double nearestMicros = microsecondsSince(start) / queries;
+    std::cout << "  ring field, full BFS      " << std::setw(10) << buildMicros / 1000.0 << " ms\n"
+              << "  route to nearest ring     " << std::setw(10) << nearestMicros << " us\n";
+
+    // Play: each round picks up, drops, kills and spawns a few things, then queries
+    const int rounds = 200;
+    std::size_t changes = 0;
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            const auto square = randomSquare(3000000 + round * 8 + i);
+            switch (i) {
+            case 0:
+                board.removeItem(square.first, square.second);
+                break;
+            case 1:
+                board.setItem(square.first, square.second, ItemCatalog::RING_OF_LIFE);
+                break;
+            case 2:
+                board.removeEnemy(square.first, square.second);
+                break;
+            default:
+                board.setEnemy(square.first, square.second, Race::Orc, raceTraits(Race::Orc).health);
+                break;
+            }
+            ++changes;
+        }
+        const auto from = randomSquare(4000000 + round);
+        pathfinder.distanceTo(Pathfinder::Target::Ring, from.first, from.second);
+    }
+    const double repairMicros = microsecondsSince(start) / rounds;
+    std::cout << "  4 changes + ring query    " << std::setw(10) << repairMicros << " us per round ("
+              << pathfinder.getRepairs() << " repairs, " << pathfinder.getFullRebuilds() << " full builds)\n";
+
+    // The repaired field must equal one built from scratch
+    Pathfinder fresh(board);
+    std::size_t mismatched = 0;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            if (pathfinder.distanceTo(Pathfinder::Target::Ring, x, y) != fresh.distanceTo(Pathfinder::Target::Ring, x, y)) {
+                ++mismatched;
+            }
+        }
+    }
+    errors += mismatched;
+    std::cout << (errors == 0 ? "Routes match BFS and repaired fields match a fresh build\n"
+                              : "ERROR: " + std::to_string(errors) + " wrong distances\n");
+    return errors == 0 && changes > 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file RaceDispatchBenchmark.cpp
+ * @brief Compares virtual race dispatch with the race-specialized combat kernels
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Combat.h"
+#include "CounterRng.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace {
+
+/**
+ * @struct Arena
+ * @brief Every race pair fighting, with items on some fighters
+ */
+struct Arena {
+    std::vector<std::shared_ptr<Character>> attackers;
+    std::vector<std::shared_ptr<Character>> defenders;
+
+    explicit Arena(int copies) {
+        for (int copy = 0; copy < copies; ++copy) {
+            for (int pair = 0; pair < 25; ++pair) {
+                attackers.push_back(Board::createEnemy(static_cast<Race>(pair / 5)));
+                defenders.push_back(Board::createEnemy(static_cast<Race>(pair % 5)));
+                if (copy % 2 == 1) {
+                    attackers.back()->getInventory().addItem(ItemCatalog::SWORD);
+                    defenders.back()->getInventory().addItem(ItemCatalog::SMALL_SHIELD);
+                }
+            }
+        }
+    }
+};
+
+} // namespace
+
+int runRaceDispatchBenchmark(const std::vector<std::string>& args) {
+    const int copies = args.size() > 0 ? std::stoi(args[0]) : 40;
+    const std::size_t rounds = args.size() > 1 ? std::stoul(args[1]) : 2000;
+
+    // One shared roll sequence; both paths consume it identically
+    const CounterRng rng(11);
+    std::vector<CombatRoll> rolls(rounds);
+    for (std::size_t i = 0; i < rounds; ++i) {
+        const CounterRng::Block block = rng(i);
+        rolls[i] = CombatRoll{CounterRng::toUnit(block[0]), CounterRng::toUnit(block[1]),
+                              CounterRng::toUnit(block[2])};
+    }
+
+    Arena dynamicArena(copies);
+    Arena specializedArena(copies);
+    const std::size_t fights = dynamicArena.attackers.size();
+    const double total = static_cast<double>(fights) * rounds;
+    std::cout << "Race dispatch, " << fights << " fights x " << rounds << " rounds\n";
+
+    long dynamicGold = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t f = 0; f < fights; ++f) {
+        Character& attacker = *dynamicArena.attackers[f];
+        Character& defender = *dynamicArena.defenders[f];
+        for (std::size_t r = 0; r < rounds; ++r) {
+            dynamicGold += Combat::executeCombatRound(attacker, defender, r % 2 == 0, rolls[r]).second;
+        }
+    }
+    auto middle = std::chrono::steady_clock::now();
+
+    long specializedGold = 0;
+    for (std::size_t f = 0; f < fights; ++f) {
+        Character& attacker = *specializedArena.attackers[f];
+        Character& defender = *specializedArena.defenders[f];
+        const Combat::RoundFunction round = Combat::getRoundFunction(attacker.getRaceId(), defender.getRaceId());
+        for (std::size_t r = 0; r < rounds; ++r) {
+            specializedGold += round(attacker, defender, r % 2 == 0, rolls[r]).second;
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double dynamicNanos = std::chrono::duration<double, std::nano>(middle - start).count() / total;
+    double specializedNanos = std::chrono::duration<double, std::nano>(stop - middle).count() / total;
+
+    std::size_t mismatches = 0;
+    for (std::size_t f = 0; f < fights; ++f) {
+        if (dynamicArena.defenders[f]->getHealth() != specializedArena.defenders[f]->getHealth()) ++mismatches;
+    }
+
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(14) << "virtual" << std::setw(12) << dynamicNanos << " ns/round  (gold " << dynamicGold << ")\n"
+              << std::setw(14) << "specialized" << std::setw(12) << specializedNanos
+              << " ns/round  (gold " << specializedGold << ")\n"
+              << "Speedup: " << std::setprecision(1) << dynamicNanos / specializedNanos << "x\n";
+
+    bool consistent = mismatches == 0 && dynamicGold == specializedGold;
+    std::cout << (consistent ? "Specialized rounds match virtual dispatch\n"
+                             : "ERROR: " + std::to_string(mismatches) + " fights differ from virtual dispatch\n");
+    return consistent ? 0 : 1;
+}
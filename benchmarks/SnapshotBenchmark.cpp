@@ -0,0 +1,81 @@
+/**
+ * @file SnapshotBenchmark.cpp
+ * @brief Times saving and loading a full game snapshot
+ */
+
+#include "Benchmarks.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include "TextRenderer.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief Compare every square of two boards
+ * @return std::size_t Number of squares that differ
+ */
+std::size_t countDifferentCells(const Board& a, const Board& b) {
+    const auto size = a.getDimensions();
+    std::size_t differences = 0;
+    for (int y = 0; y < size.second; ++y) {
+        for (int x = 0; x < size.first; ++x) {
+            if (a.getCellRecord(x, y) != b.getCellRecord(x, y)) {
+                ++differences;
+            }
+        }
+    }
+    return differences;
+}
+
+} // namespace
+
+int runSnapshotBenchmark(const std::vector<std::string>& args) {
+    const int size = args.size() > 0 ? std::stoi(args[0]) : 4096;
+    const std::uint64_t seed = args.size() > 1 ? std::stoull(args[1]) : 42;
+    const std::string path = (std::filesystem::temp_directory_path() / "shadows-snapshot-bench.bin").string();
+
+    Game original(seed);
+    original.initializeGame(size, size, "dwarf", "Gimli");
+
+    // Play a little so the player, counters and generators are not at their start
+    const char* const warmup[] = {"e", "s", "p", "a", "e", "a", "s", "p", "l", "a"};
+    for (const char* command : warmup) {
+        original.execute(command);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    GameSnapshot::save(original, path);
+    auto saved = std::chrono::steady_clock::now();
+    std::unique_ptr<Game> restored = GameSnapshot::load(path);
+    auto loaded = std::chrono::steady_clock::now();
+
+    const double bytes = static_cast<double>(std::filesystem::file_size(path));
+    std::remove(path.c_str());
+
+    std::cout << "Snapshot of a " << size << "x" << size << " board, " << std::fixed << std::setprecision(1)
+              << bytes / (1024.0 * 1024.0) << " MiB\n"
+              << std::setprecision(2)
+              << "  save " << std::chrono::duration<double, std::milli>(saved - start).count() << " ms\n"
+              << "  load " << std::chrono::duration<double, std::milli>(loaded - saved).count() << " ms\n";
+
+    // The restored game must match and keep playing identically
+    std::size_t differences = countDifferentCells(original.getBoard(), restored->getBoard());
+    if (original.getGameStatus() != restored->getGameStatus()) ++differences;
+    const char* const script[] = {"s", "e", "a", "p", "i", "a", "w", "n", "a", "look"};
+    for (int turn = 0; turn < 200; ++turn) {
+        const char* command = script[turn % 10];
+        if (TextRenderer::render(original.execute(command), original) !=
+            TextRenderer::render(restored->execute(command), *restored)) {
+            ++differences;
+        }
+    }
+
+    std::cout << (differences == 0 ? "Restored game matches the original\n"
+                                   : "ERROR: " + std::to_string(differences) + " differences after restore\n");
+    return differences == 0 ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file SpatialQueryBenchmark.cpp
+ * @brief Compares scanning the occupancy bitset with the spatial index for nearest and range queries
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief The scan Board::findNearestItem used before SpatialIndex
+ * @param bits Occupancy bitset
+ * @param width Board width
+ * @param x X coordinate to search from
+ * @param y Y coordinate to search from
+ * @return std::pair<int, int> Nearest set cell, first in row-major order on ties
+ */
+std::pair<int, int> legacyNearest(const std::vector<std::uint64_t>& bits, int width, int x, int y) {
+    std::pair<int, int> best(-1, -1);
+    long bestDistance = -1;
+    for (std::size_t w = 0; w < bits.size(); ++w) {
+        std::uint64_t word = bits[w];
+        while (word) {
+            std::size_t cell = w * 64 + BoardOccupancy::lowestBit(word);
+            word &= word - 1;
+            int cellX = static_cast<int>(cell % width);
+            int cellY = static_cast<int>(cell / width);
+            long distance = std::abs(cellX - x) + std::abs(cellY - y);
+            if (bestDistance < 0 || distance < bestDistance) {
+                bestDistance = distance;
+                best = std::make_pair(cellX, cellY);
+                if (distance == 0) return best;
+            }
+        }
+    }
+    return best;
+}
+
+double microsecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int runSpatialQueryBenchmark(const std::vector<std::string>& args) {
+    const int size = std::max(64, args.size() > 0 ? std::stoi(args[0]) : 2048);
+    const std::size_t queries = args.size() > 1 ? std::stoul(args[1]) : 2000;
+    const std::uint64_t seed = 42;
+
+    std::cout << "Board of " << size << "x" << size << ", " << queries << " queries each\n"
+              << std::fixed << std::setprecision(3);
+
+    Board board(size, size);
+    board.initializeBoard(seed, 0);
+
+    // Sparse enemies: clear all but ~1 in 4096 so nearest queries must search far
+    const BoardOccupancy& occupancy = board.getOccupancy();
+    const CounterRng rng(seed);
+    auto start = std::chrono::steady_clock::now();
+    std::size_t updates = 0;
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            if (occupancy.hasEnemy(static_cast<std::size_t>(y) * size + x) &&
+                CounterRng::bounded(rng(static_cast<std::uint64_t>(y) * size + x)[0], 820) != 0) {
+                board.removeEnemy(x, y);
+                ++updates;
+            }
+        }
+    }
+    const double removeMicros = microsecondsSince(start);
+    std::cout << "  " << updates << " removeEnemy calls (index kept current): "
+              << removeMicros * 1000.0 / updates << " ns each\n";
+
+    std::vector<std::pair<int, int>> points(queries);
+    for (std::size_t i = 0; i < queries; ++i) {
+        const CounterRng::Block roll = rng(0xABCDEF00ULL + i);
+        points[i] = {static_cast<int>(CounterRng::bounded(roll[0], size)),
+                     static_cast<int>(CounterRng::bounded(roll[1], size))};
+    }
+
+    std::size_t differences = 0;
+    std::size_t checksum = 0;
+    const char* names[2] = {"item", "enemy"};
+    for (int layer = 0; layer < 2; ++layer) {
+        const std::vector<std::uint64_t>& bits = layer == 0 ? occupancy.getItemBits() : occupancy.getEnemyBits();
+
+        std::vector<std::pair<int, int>> scanned(queries);
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < queries; ++i) {
+            scanned[i] = legacyNearest(bits, size, points[i].first, points[i].second);
+        }
+        const double scanMicros = microsecondsSince(start) / queries;
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < queries; ++i) {
+            const std::pair<int, int> found = layer == 0 ? board.findNearestItem(points[i].first, points[i].second)
+                                                         : board.findNearestEnemy(points[i].first, points[i].second);
+            if (found != scanned[i]) ++differences;
+        }
+        const double indexMicros = microsecondsSince(start) / queries;
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < queries; ++i) {
+            const auto nearest = layer == 0 ? board.findNearestItems(points[i].first, points[i].second, 10)
+                                            : board.findNearestEnemies(points[i].first, points[i].second, 10);
+            checksum += nearest.size();
+            // Results must come out in non-decreasing distance
+            for (std::size_t j = 1; j < nearest.size(); ++j) {
+                const auto distance = [&](const std::pair<int, int>& cell) {
+                    return std::abs(cell.first - points[i].first) + std::abs(cell.second - points[i].second);
+                };
+                if (distance(nearest[j]) < distance(nearest[j - 1])) ++differences;
+            }
+        }
+        const double tenMicros = microsecondsSince(start) / queries;
+
+        std::cout << "  nearest " << std::left << std::setw(6) << names[layer] << std::right
+                  << " scan " << std::setw(10) << scanMicros << " us   index " << std::setw(8) << indexMicros
+                  << " us   10 nearest " << std::setw(8) << tenMicros << " us   speedup "
+                  << std::setprecision(0) << scanMicros / indexMicros << "x\n" << std::setprecision(3);
+    }
+
+    // 64x64 range queries must match a square-by-square count
+    start = std::chrono::steady_clock::now();
+    std::size_t inRange = 0;
+    for (std::size_t i = 0; i < queries; ++i) {
+        const int x0 = std::min(points[i].first, size - 64);
+        const int y0 = std::min(points[i].second, size - 64);
+        inRange += board.findItemsInRange(x0, y0, x0 + 63, y0 + 63).size();
+    }
+    const double rangeMicros = microsecondsSince(start) / queries;
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < queries; ++i) {
+        const int x0 = std::min(points[i].first, size - 64);
+        const int y0 = std::min(points[i].second, size - 64);
+        for (int y = y0; y < y0 + 64; ++y) {
+            for (int x = x0; x < x0 + 64; ++x) {
+                expected += occupancy.hasItem(static_cast<std::size_t>(y) * size + x) ? 1 : 0;
+            }
+        }
+    }
+    if (inRange != expected) ++differences;
+    std::cout << "  items in a 64x64 range  " << std::setw(10) << rangeMicros << " us ("
+              << inRange / queries << " found per query)\n";
+
+    std::cout << (differences == 0 ? "Index answers match the full scan\n"
+                                   : "ERROR: " + std::to_string(differences) + " answers differ from the full scan\n");
+    return differences == 0 && checksum > 0 ? 0 : 1;
+}
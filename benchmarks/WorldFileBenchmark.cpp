@@ -0,0 +1,86 @@
+/**
+ * @file WorldFileBenchmark.cpp
+ * @brief Compares generating a board at startup with opening a mapped world file
+ */
+
+#include "Benchmarks.h"
+#include "Board.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include "WorldFile.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int runWorldFileBenchmark(const std::vector<std::string>& args) {
+    const int size = args.size() > 0 ? std::stoi(args[0]) : 2048;
+    const int sessions = args.size() > 1 ? std::stoi(args[1]) : 1000;
+    const std::uint64_t seed = 42;
+    const std::string path = (std::filesystem::temp_directory_path() / "shadows-world-bench.bin").string();
+
+    std::cout << "World of " << size << "x" << size << ", " << sessions << " sessions\n" << std::fixed
+              << std::setprecision(2);
+
+    // Startup today: every session generates its own dense board
+    auto start = std::chrono::steady_clock::now();
+    Game reference(seed);
+    reference.initializeGame(size, size, "human", "World");
+    std::cout << "  generate one dense board   " << std::setw(10) << millisecondsSince(start) << " ms\n";
+    GameSnapshot::save(reference, path);
+
+    // Startup from the file: map once, then every session opens a board on it
+    start = std::chrono::steady_clock::now();
+    std::shared_ptr<const WorldFile> world = WorldFile::open(path);
+    std::vector<std::unique_ptr<Board>> boards;
+    for (int i = 0; i < sessions; ++i) {
+        boards.push_back(std::make_unique<Board>(world, Game::WORLD_CHUNK_BUDGET));
+    }
+    const double openMs = millisecondsSince(start);
+    std::cout << "  map file + open all boards " << std::setw(10) << openMs << " ms ("
+              << std::setprecision(3) << openMs * 1000.0 / sessions << " us per session, "
+              << (world->isMapped() ? "mmap" : "read") << ")\n" << std::setprecision(2);
+
+    // Every square of a 256x256 corner (16 chunks) must match the generated board
+    const Board& dense = reference.getBoard();
+    Board& mapped = *boards.front();
+    const int corner = std::min(size, 256);
+    std::size_t differences = 0;
+    start = std::chrono::steady_clock::now();
+    for (int y = 0; y < corner; ++y) {
+        for (int x = 0; x < corner; ++x) {
+            if (dense.getCellRecord(x, y) != mapped.getCellRecord(x, y)) {
+                ++differences;
+            }
+        }
+    }
+    std::cout << "  first touch of 16 chunks   " << std::setw(10) << millisecondsSince(start) << " ms\n";
+
+    // A change in one session is private to it and survives eviction
+    const CellRecord original = mapped.getCellRecord(1, 1);
+    mapped.removeItem(1, 1);
+    mapped.removeEnemy(1, 1);
+    for (int y = 0; y < size; y += ChunkedWorld::CHUNK_SIZE) {
+        mapped.getSquare(size - 1, y); // Touch enough chunks to evict the first
+    }
+    if (!mapped.getSquare(1, 1)->getIsEmpty()) ++differences;
+    if (sessions > 1 && boards[1]->getCellRecord(1, 1) != original) ++differences;
+    if (world->getCell(1, 1) != original) ++differences;
+
+    boards.clear();
+    world.reset();
+    std::remove(path.c_str());
+
+    std::cout << (differences == 0 ? "Mapped boards match the generated board; changes stay per session\n"
+                                   : "ERROR: " + std::to_string(differences) + " differences\n");
+    return differences == 0 ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+QT = core
+
+CONFIG += c++17 cmdline release
+TARGET = benchmarks
+
+# Benchmarks link against the same engine sources as the game
+include(../src/core.pri)
+
+SOURCES += \
+    main.cpp \
+    BoardGenerationBenchmark.cpp \
+    InventoryStatsBenchmark.cpp \
+    CombatRoundsBenchmark.cpp \
+    CombatBatchBenchmark.cpp \
+    RaceDispatchBenchmark.cpp \
+    CommandParseBenchmark.cpp \
+    SnapshotBenchmark.cpp \
+    WorldFileBenchmark.cpp \
+    JournalBenchmark.cpp \
+    SpatialQueryBenchmark.cpp \
+    PathfindingBenchmark.cpp \
+    EnemyTickBenchmark.cpp
+
+HEADERS += \
+    Benchmarks.h
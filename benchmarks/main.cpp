@@ -0,0 +1,81 @@
+/**
+ * @file main.cpp
+ * @brief Command-line driver for the engine benchmarks
+ */
+
+#include "Benchmarks.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Main function - runs the benchmark named on the command line
+ * @return Exit status (0 for success, 1 for error)
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: benchmarks <name> [args...]\n";
+        std::cerr << "Available benchmarks:\n";
+        std::cerr << "  board-generation [width] [height] [seed]\n";
+        std::cerr << "  inventory-stats [iterations]\n";
+        std::cerr << "  combat-rounds [fights] [passes]\n";
+        std::cerr << "  combat-batch [pairs] [rounds] [seed]\n";
+        std::cerr << "  race-dispatch [copies] [rounds]\n";
+        std::cerr << "  command-parse [iterations]\n";
+        std::cerr << "  snapshot [size] [seed]\n";
+        std::cerr << "  world-file [size] [sessions]\n";
+        std::cerr << "  journal [commands] [seed]\n";
+        std::cerr << "  spatial-query [size] [queries]\n";
+        std::cerr << "  pathfinding [size] [queries]\n";
+        std::cerr << "  enemy-tick [size] [ticks]\n";
+        return 1;
+    }
+
+    std::string name = argv[1];
+    std::vector<std::string> args(argv + 2, argv + argc);
+
+    try {
+        if (name == "board-generation") {
+            return runBoardGenerationBenchmark(args);
+        }
+        if (name == "inventory-stats") {
+            return runInventoryStatsBenchmark(args);
+        }
+        if (name == "combat-rounds") {
+            return runCombatRoundsBenchmark(args);
+        }
+        if (name == "combat-batch") {
+            return runCombatBatchBenchmark(args);
+        }
+        if (name == "race-dispatch") {
+            return runRaceDispatchBenchmark(args);
+        }
+        if (name == "command-parse") {
+            return runCommandParseBenchmark(args);
+        }
+        if (name == "snapshot") {
+            return runSnapshotBenchmark(args);
+        }
+        if (name == "world-file") {
+            return runWorldFileBenchmark(args);
+        }
+        if (name == "journal") {
+            return runJournalBenchmark(args);
+        }
+        if (name == "spatial-query") {
+            return runSpatialQueryBenchmark(args);
+        }
+        if (name == "pathfinding") {
+            return runPathfindingBenchmark(args);
+        }
+        if (name == "enemy-tick") {
+            return runEnemyTickBenchmark(args);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "Benchmark failed: " << error.what() << std::endl;
+        return 1;
+    }
+
+    std::cerr << "Unknown benchmark: " << name << "\n";
+    return 1;
+}
@@ -16,6 +16,10 @@ std::string Armour::getCategory() const {
     return "Armour";
 }
 
+ItemCategory Armour::getCategoryId() const {
+    return ItemCategory::Armour;
+}
+
 int Armour::getWeight() const {
     return weight;
 }
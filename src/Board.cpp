@@ -9,76 +9,304 @@
 #include "Dwarf.h"
 #include "Orc.h"
 #include "Elf.h"
-#include <random>
+#include "RaceTraits.h"
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <algorithm>
 
 Board::Board(int boardWidth, int boardHeight)
-    : width(boardWidth), height(boardHeight), playerX(0), playerY(0),
-    isDaytime(true), commandCount(0) {
-
-    // Initialize the 2D grid with smart pointers
-    squares.resize(height);
-    for (int i = 0; i < height; ++i) {
-        squares[i].resize(width);
-        for (int j = 0; j < width; ++j) {
-            // Create each square with std::make_shared as required
-            squares[i][j] = std::make_shared<Square>();
-        }
+    : occupancy(static_cast<std::size_t>(boardWidth) * static_cast<std::size_t>(boardHeight)),
+    width(boardWidth), height(boardHeight), playerX(0), playerY(0),
+    isDaytime(true), commandCount(0), boardSeed(0) {
+    if (occupancy.size() > std::numeric_limits<std::uint32_t>::max()) {
+        // The enemy registry records positions as 32-bit cells
+        throw std::length_error("Board has too many squares");
     }
+
+    // Allocate the whole grid in one block; every square starts empty
+    squares.resize(occupancy.size());
+    occupancy.enableSpatialIndex(width, height);
+}
+
+Board::Board(int boardWidth, int boardHeight, std::uint64_t seed, std::size_t chunkMemoryBudget)
+    : occupancy(0), width(boardWidth), height(boardHeight), playerX(0), playerY(0),
+    isDaytime(true), commandCount(0), boardSeed(seed),
+    world(std::make_unique<ChunkedWorld>(seed, boardWidth, boardHeight, chunkMemoryBudget, 0, 0)) {
+    // Chunks are generated on first access
+}
+
+Board::Board(std::shared_ptr<const WorldFile> file, std::size_t chunkMemoryBudget)
+    : occupancy(0), width(file->getHeader().width), height(file->getHeader().height),
+    playerX(file->getHeader().playerX), playerY(file->getHeader().playerY),
+    isDaytime(file->getHeader().isDaytime != 0), commandCount(file->getHeader().commandCount),
+    boardSeed(file->getHeader().boardSeed),
+    world(std::make_unique<ChunkedWorld>(std::move(file), chunkMemoryBudget)) {
+    // Chunks are copied from the file on first access
 }
 
 void Board::initializeBoard() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> itemDist(0, 3); // 25% chance for item
-    std::uniform_int_distribution<> enemyDist(0, 4); // 20% chance for enemy
-    std::uniform_int_distribution<> raceDist(0, 4);  // Random race selection
-
-    for (int i = 0; i < height; ++i) {
-        for (int j = 0; j < width; ++j) {
-            if (i == playerY && j == playerX) continue;
-
-            if (itemDist(gen) == 0) {
-                std::shared_ptr<Item> randomItem = ItemFactory::createRandomItem();
-                squares[i][j]->setItem(randomItem);
-            }
+    // Fresh random world each call, generated on the calling thread
+    Rng rng = Rng::fromEntropy();
+    initializeBoard(rng);
+}
+
+void Board::initializeBoard(Rng& rng) {
+    initializeBoard(rng(), 1);
+}
+
+void Board::initializeBoard(std::uint64_t seed, unsigned int threads) {
+    boardSeed = seed;
+
+    if (world) {
+        // Chunked boards generate lazily from the seed
+        world->reset(seed);
+        return;
+    }
 
-            if (enemyDist(gen) == 0) {
-                // Randomly select enemy race but all with same balanced stats
-                int raceChoice = raceDist(gen);
-                std::shared_ptr<Character> enemy;
-
-                switch (raceChoice) {
-                case 0:
-                    enemy = std::make_shared<Human>("Evil Human");
-                    break;
-                case 1:
-                    enemy = std::make_shared<Elf>("Bad Elf");
-                    break;
-                case 2:
-                    enemy = std::make_shared<Dwarf>("Tiny Dwarf");
-                    break;
-                case 3:
-                    enemy = std::make_shared<Hobbit>("Clone Hobbit");
-                    break;
-                case 4:
-                    enemy = std::make_shared<Orc>("Orcy Orc");
-                    break;
-                default:
-                    enemy = std::make_shared<Human>("Evil Human");
+    // Bulk placement needs an empty grid. Every square is emptied, so no
+    // enemy handle into the old board survives and the registry starts over
+    occupancy.disableSpatialIndex();
+    occupancy.clearAll(squares);
+
+    const CounterRng rng(seed);
+    fillGrid(threads, [this, &rng](std::size_t begin, std::size_t end, std::vector<PendingEnemy>& found) {
+        int x = static_cast<int>(begin % width);
+        int y = static_cast<int>(begin / width);
+        for (std::size_t cell = begin; cell < end; ++cell) {
+            if (x == playerX && y == playerY) {
+                // The player's square always starts empty
+                occupancy.removeItem(squares[cell], cell);
+            } else {
+                // Invalid ids (including NONE) clear whatever item was there
+                const CellRecord record = rollCell(rng, x, y);
+                occupancy.setItem(squares[cell], cell, static_cast<ItemId>(record.itemType));
+                if (record.enemyRace != BoardOccupancy::NONE) {
+                    found.push_back(PendingEnemy{static_cast<std::uint32_t>(cell), record});
                 }
+            }
+            if (++x == width) {
+                x = 0;
+                ++y;
+            }
+        }
+    });
+}
 
-                squares[i][j]->setEnemy(enemy);
+/**
+ * @brief Fill the grid of a dense board without enemies on several threads
+ *
+ * Pseudo-code:
+ * 1. Split the grid into runs of whole 64-cell words, one per thread, so
+ *    no two threads ever write the same occupancy bitset word; drop the
+ *    spatial index, which is shared by all cells
+ * 2. Each thread fills its run and lists the run's enemies
+ * 3. Add registry entries for all of them at once; thread t owns the block
+ *    after the enemies of threads 0..t-1, so entries stay in cell order
+ * 4. Each thread registers its enemies in its own block and puts them on
+ *    their squares
+ * 5. Rebuild the spatial index
+ */
+void Board::fillGrid(unsigned int threads, const RangeFill& fillRange) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t total = squares.size();
+    const std::size_t words = (total + 63) / 64;
+    const std::size_t wordsPerThread = (words + threads - 1) / threads;
+
+    auto runOnThreads = [&](const std::function<void(unsigned int, std::size_t, std::size_t)>& job) {
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < threads; ++t) {
+            std::size_t begin = std::min(total, t * wordsPerThread * 64);
+            std::size_t end = std::min(total, (t + 1) * wordsPerThread * 64);
+            if (begin < end) {
+                workers.emplace_back(job, t, begin, end);
             }
         }
+        job(0, 0, std::min(total, wordsPerThread * 64));
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    occupancy.disableSpatialIndex();
+    std::vector<std::vector<PendingEnemy>> pending(threads);
+    runOnThreads([&](unsigned int t, std::size_t begin, std::size_t end) { fillRange(begin, end, pending[t]); });
+
+    EnemyRegistry& enemies = occupancy.getEnemies();
+    std::size_t count = 0;
+    for (const auto& found : pending) {
+        count += found.size();
+    }
+    std::vector<std::size_t> firstEntry(threads);
+    std::size_t next = enemies.extend(count);
+    for (unsigned int t = 0; t < threads; ++t) {
+        firstEntry[t] = next;
+        next += pending[t].size();
+    }
+
+    runOnThreads([&](unsigned int t, std::size_t, std::size_t) {
+        std::size_t entry = firstEntry[t];
+        for (const PendingEnemy& enemy : pending[t]) {
+            const Race race = static_cast<Race>(enemy.record.enemyRace);
+            Square& square = squares[enemy.cell];
+            square.enemy = enemies.place(entry++, race, enemy.record.enemyHealth, enemy.cell);
+            occupancy.setEnemy(enemy.cell, enemy.record.enemyRace);
+        }
+        std::vector<PendingEnemy>().swap(pending[t]);
+    });
+    occupancy.enableSpatialIndex(width, height);
+}
+
+CellRecord Board::rollCell(const CounterRng& rng, int x, int y) {
+    // One Philox block per cell, keyed by its absolute coordinates:
+    // word 0 = item roll, 1 = item type, 2 = enemy roll, 3 = enemy race
+    const std::uint64_t counter = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(y)) << 32) |
+                                  static_cast<std::uint32_t>(x);
+    const CounterRng::Block roll = rng(counter);
+    CellRecord record = {BoardOccupancy::NONE, BoardOccupancy::NONE, 0};
+
+    if (CounterRng::bounded(roll[0], 4) == 0) { // 25% chance for item
+        record.itemType = static_cast<std::uint8_t>(CounterRng::bounded(roll[1], ItemCatalog::COUNT));
+    }
+
+    if (CounterRng::bounded(roll[2], 5) == 0) { // 20% chance for enemy
+        // Randomly select enemy race but all with same balanced stats
+        const Race race = static_cast<Race>(CounterRng::bounded(roll[3], 5));
+        record.enemyRace = static_cast<std::uint8_t>(race);
+        record.enemyHealth = static_cast<std::int16_t>(raceTraits(race).health);
+    }
+    return record;
+}
+
+void Board::populateSquare(Square& square, BoardOccupancy& layer, std::size_t cell,
+                           const CounterRng& rng, int x, int y) {
+    const CellRecord record = rollCell(rng, x, y);
+    if (record.itemType != BoardOccupancy::NONE) {
+        layer.setItem(square, cell, static_cast<ItemId>(record.itemType));
+    }
+    if (record.enemyRace != BoardOccupancy::NONE) {
+        layer.setEnemy(square, cell, static_cast<Race>(record.enemyRace), record.enemyHealth);
+    }
+}
+
+std::unique_ptr<Character> Board::createEnemy(Race race) {
+    const char* name = EnemyRegistry::getName(race);
+    switch (race) {
+    case Race::Human:
+        return std::make_unique<Human>(name);
+    case Race::Elf:
+        return std::make_unique<Elf>(name);
+    case Race::Dwarf:
+        return std::make_unique<Dwarf>(name);
+    case Race::Hobbit:
+        return std::make_unique<Hobbit>(name);
+    case Race::Orc:
+        return std::make_unique<Orc>(name);
+    default:
+        return std::make_unique<Human>(name);
     }
 }
 
-std::shared_ptr<Square> Board::getSquare(int x, int y) const {
+std::uint64_t Board::getSeed() const {
+    return boardSeed;
+}
+
+Square* Board::getSquare(int x, int y) {
     // Check bounds before accessing
     if (x < 0 || x >= width || y < 0 || y >= height) {
         return nullptr;
     }
-    return squares[y][x];
+    if (world) {
+        return &world->getSquare(x, y);
+    }
+    return &squares[indexOf(x, y)];
+}
+
+const Square* Board::getSquare(int x, int y) const {
+    // Check bounds before accessing
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return nullptr;
+    }
+    if (world) {
+        // Loading a chunk does not change the board's observable contents
+        return &world->getSquare(x, y);
+    }
+    return &squares[indexOf(x, y)];
+}
+
+void Board::setItem(int x, int y, ItemId itemId) {
+    const SquareRef ref = locate(x, y);
+    if (ref.square) {
+        ref.layer->setItem(*ref.square, ref.cell, itemId);
+    }
+}
+
+void Board::removeItem(int x, int y) {
+    const SquareRef ref = locate(x, y);
+    if (ref.square) {
+        ref.layer->removeItem(*ref.square, ref.cell);
+    }
+}
+
+void Board::setEnemy(int x, int y, Race race, int health) {
+    const SquareRef ref = locate(x, y);
+    if (ref.square) {
+        ref.layer->setEnemy(*ref.square, ref.cell, race, health);
+    }
+}
+
+void Board::removeEnemy(int x, int y) {
+    const SquareRef ref = locate(x, y);
+    if (ref.square) {
+        ref.layer->removeEnemy(*ref.square, ref.cell);
+    }
+}
+
+Race Board::getEnemyRace(int x, int y) const {
+    const SquareRef ref = locate(x, y);
+    if (!ref.square || ref.square->getEnemy() == EnemyRegistry::NONE) {
+        return NO_ENEMY_RACE;
+    }
+    return ref.layer->getEnemies().getRace(ref.square->getEnemy());
+}
+
+int Board::getEnemyHealth(int x, int y) const {
+    const SquareRef ref = locate(x, y);
+    if (!ref.square || ref.square->getEnemy() == EnemyRegistry::NONE) {
+        return 0;
+    }
+    return ref.layer->getEnemies().getHealth(ref.square->getEnemy());
+}
+
+void Board::setEnemyHealth(int x, int y, int health) {
+    const SquareRef ref = locate(x, y);
+    if (ref.square && ref.square->getEnemy() != EnemyRegistry::NONE) {
+        ref.layer->getEnemies().setHealth(ref.square->getEnemy(), health);
+    }
+}
+
+CellRecord Board::getCellRecord(int x, int y) const {
+    const SquareRef ref = locate(x, y);
+    if (!ref.square) {
+        return CellRecord{BoardOccupancy::NONE, BoardOccupancy::NONE, 0};
+    }
+    return CellRecord::fromSquare(*ref.square, ref.layer->getEnemies());
+}
+
+SquareRef Board::locate(int x, int y) const {
+    // Check bounds before accessing
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return SquareRef{nullptr, nullptr, 0};
+    }
+    if (world) {
+        return world->locate(x, y);
+    }
+    const std::size_t cell = indexOf(x, y);
+    // The grid and layer are owned by this board; mutation goes through non-const callers
+    return SquareRef{const_cast<Square*>(&squares[cell]), const_cast<BoardOccupancy*>(&occupancy), cell};
 }
 
 int Board::getPlayerX() const {
@@ -135,14 +363,14 @@ void Board::incrementCommandCount() {
 }
 
 std::string Board::getCurrentLocationDescription() const {
-    std::shared_ptr<Square> currentSquare = getSquare(playerX, playerY);
-    if (!currentSquare) {
+    const SquareRef current = locate(playerX, playerY);
+    if (!current.square) {
         return "Invalid location";
     }
 
     std::string description = "You are at position (" + std::to_string(playerX) +
                               ", " + std::to_string(playerY) + "). ";
-    description += currentSquare->getDescription();
+    description += current.square->getDescription(current.layer->getEnemies());
     description += "\nTime: " + std::string(isDaytime ? "Day" : "Night");
 
     return description;
@@ -151,3 +379,54 @@ std::string Board::getCurrentLocationDescription() const {
 std::pair<int, int> Board::getDimensions() const {
     return std::make_pair(width, height);
 }
+
+bool Board::isChunked() const {
+    return world != nullptr;
+}
+
+const ChunkedWorld* Board::getChunkedWorld() const {
+    return world.get();
+}
+
+const BoardOccupancy& Board::getOccupancy() const {
+    return occupancy;
+}
+
+std::size_t Board::countItems() const {
+    return world ? world->countResidentItems() : occupancy.countItems();
+}
+
+std::size_t Board::countEnemies() const {
+    return world ? world->countResidentEnemies() : occupancy.countEnemies();
+}
+
+std::pair<int, int> Board::findNearestItem(int x, int y) const {
+    std::vector<std::pair<int, int>> nearest = findNearestItems(x, y, 1);
+    return nearest.empty() ? std::make_pair(-1, -1) : nearest.front();
+}
+
+std::pair<int, int> Board::findNearestEnemy(int x, int y) const {
+    std::vector<std::pair<int, int>> nearest = findNearestEnemies(x, y, 1);
+    return nearest.empty() ? std::make_pair(-1, -1) : nearest.front();
+}
+
+std::vector<std::pair<int, int>> Board::findNearestItems(int x, int y, std::size_t k) const {
+    // Chunked boards have no board-wide occupancy layer, so no index
+    const SpatialIndex* index = occupancy.getItemIndex();
+    return index ? index->findNearest(x, y, k) : std::vector<std::pair<int, int>>();
+}
+
+std::vector<std::pair<int, int>> Board::findNearestEnemies(int x, int y, std::size_t k) const {
+    const SpatialIndex* index = occupancy.getEnemyIndex();
+    return index ? index->findNearest(x, y, k) : std::vector<std::pair<int, int>>();
+}
+
+std::vector<std::pair<int, int>> Board::findItemsInRange(int x0, int y0, int x1, int y1) const {
+    const SpatialIndex* index = occupancy.getItemIndex();
+    return index ? index->findInRange(x0, y0, x1, y1) : std::vector<std::pair<int, int>>();
+}
+
+std::vector<std::pair<int, int>> Board::findEnemiesInRange(int x0, int y0, int x1, int y1) const {
+    const SpatialIndex* index = occupancy.getEnemyIndex();
+    return index ? index->findInRange(x0, y0, x1, y1) : std::vector<std::pair<int, int>>();
+}
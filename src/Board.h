@@ -1,6 +1,6 @@
 /**
  * @file Board.h
- * @brief Game board management with smart pointers
+ * @brief Game board management with flat contiguous square storage
  */
 
 #ifndef BOARD_H
@@ -8,26 +8,51 @@
 
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <functional>
 #include "Square.h"
+#include "BoardOccupancy.h"
+#include "CellRecord.h"
 #include "ItemFactory.h"
 #include "Character.h"
+#include "CounterRng.h"
+#include "Rng.h"
+#include "ChunkedWorld.h"
 
 /**
  * @class Board
- * @brief Manages the game board using smart pointers
+ * @brief Manages the game board as a flat row-major grid
  *
- * Creates and manages a 2D grid of squares using std::shared_ptr.
- * Handles player movement, board initialization, and square interactions.
+ * Squares are owned by value in a single contiguous vector, so a cell
+ * lookup is one multiply-add and whole-board scans stream through cache.
+ * A parallel BoardOccupancy layer mirrors square contents for whole-map
+ * queries. Handles player movement, board initialization, and square
+ * interactions.
+ *
+ * Enemies live in the EnemyRegistry of the occupancy layer, and squares
+ * hold handles to them, so destroying a board frees its enemies with a
+ * handful of arrays instead of one object at a time.
+ *
+ * A board can instead be backed by a ChunkedWorld, which generates 64x64
+ * chunks lazily and keeps only a bounded cache of them in memory. Square
+ * access, movement and location descriptions behave the same in both
+ * modes.
  */
 class Board {
 private:
-    std::vector<std::vector<std::shared_ptr<Square>>> squares;
+    std::vector<Square> squares;        // Row-major: index = y * width + x
+    BoardOccupancy occupancy;
     int width;
     int height;
     int playerX;
     int playerY;
     bool isDaytime;
     int commandCount;
+    std::uint64_t boardSeed;
+    std::unique_ptr<ChunkedWorld> world; // Set only for chunked boards
+
+    friend class GameSnapshot;     // Saves and restores the fields above
+    friend class EnemySimulation;  // Moves enemies between squares in bulk
 
 public:
     /**
@@ -37,18 +62,194 @@ public:
      */
     Board(int boardWidth, int boardHeight);
 
+    /**
+     * @brief Constructor for a lazily generated, chunked Board
+     * @param boardWidth Width of the game board (may far exceed available memory)
+     * @param boardHeight Height of the game board
+     * @param seed World seed; chunks are generated from (seed, chunkX, chunkY)
+     * @param chunkMemoryBudget Approximate bytes the resident chunk cache may use
+     *
+     * No squares are allocated up front. In this mode getSquare() pointers
+     * stay valid only until another chunk has to be loaded.
+     */
+    Board(int boardWidth, int boardHeight, std::uint64_t seed, std::size_t chunkMemoryBudget);
+
+    /**
+     * @brief Constructor for a Board backed by a pre-built world file
+     * @param file Mapped world (see WorldFile); may be shared by many boards
+     * @param chunkMemoryBudget Approximate bytes of squares kept resident
+     *
+     * O(1) in the size of the world: size, player start, time of day and
+     * seed come from the file header, and squares are copied from the
+     * mapping chunk by chunk as the player reaches them. Changes stay in
+     * this board.
+     */
+    Board(std::shared_ptr<const WorldFile> file, std::size_t chunkMemoryBudget);
+
+    // Squares hold handles into this board's enemy registry
+    Board(const Board&) = delete;
+    Board& operator=(const Board&) = delete;
+
     /**
      * @brief Initialize the board with random items and enemies
+     *
+     * Draws a fresh seed from std::random_device and generates on the
+     * calling thread; see initializeBoard(std::uint64_t, unsigned int).
      */
     void initializeBoard();
 
+    /**
+     * @brief Initialize the board with a seed drawn from the caller's random stream
+     * @param rng Random stream to draw the board seed from
+     */
+    void initializeBoard(Rng& rng);
+
+    /**
+     * @brief Initialize the board deterministically from a seed
+     * @param seed Seed selecting the world; equal seeds give identical boards
+     * @param threads Worker threads to generate with (0 = all hardware threads)
+     *
+     * Every cell draws its rolls from a counter-based generator keyed by
+     * the seed and the cell's coordinates, so the result is bit-identical
+     * for any thread count. All previous contents of a dense board, items
+     * and enemies alike (the player's square included), are discarded, so
+     * re-initializing matches a fresh board with the same seed; enemy
+     * handles read from the old squares must not be used afterwards. A chunked
+     * board discards its chunks and regenerates them lazily from the new
+     * seed instead.
+     */
+    void initializeBoard(std::uint64_t seed, unsigned int threads);
+
+    /**
+     * @brief Get the seed used by the last initializeBoard call
+     * @return std::uint64_t Board seed
+     */
+    std::uint64_t getSeed() const;
+
+    /**
+     * @brief Roll the contents the board generation rules give a single cell
+     * @param rng Generator keyed by the world seed
+     * @param x Absolute X coordinate of the cell
+     * @param y Absolute Y coordinate of the cell
+     * @return CellRecord Item and full-health enemy of the cell, if any
+     */
+    static CellRecord rollCell(const CounterRng& rng, int x, int y);
+
+    /**
+     * @brief Apply the board generation rules to a single square
+     * @param square Square to populate
+     * @param layer Occupancy layer of the square
+     * @param cell Row-major cell index of the square within the layer
+     * @param rng Generator keyed by the world seed
+     * @param x Absolute X coordinate of the square
+     * @param y Absolute Y coordinate of the square
+     */
+    static void populateSquare(Square& square, BoardOccupancy& layer, std::size_t cell,
+                               const CounterRng& rng, int x, int y);
+
+    /**
+     * @brief Create a standalone stock character of the given race
+     * @param race Race of the character
+     * @return std::unique_ptr<Character> Full-health character named as an enemy of that race
+     *
+     * Enemies on the board are not characters; combat builds one of these
+     * from an enemy's race and health when it needs to.
+     */
+    static std::unique_ptr<Character> createEnemy(Race race);
+
     /**
      * @brief Get the square at specified coordinates
      * @param x X coordinate
      * @param y Y coordinate
-     * @return std::shared_ptr<Square> Pointer to square
+     * @return Square* Pointer into the board's storage, or nullptr if out of bounds
+     *
+     * The pointer is non-owning and stays valid for the lifetime of a dense
+     * board (see the chunked constructor for the chunked-mode rule).
+     */
+    Square* getSquare(int x, int y);
+
+    /**
+     * @brief Get the square at specified coordinates (read-only)
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return const Square* Pointer into the board's storage, or nullptr if out of bounds
+     */
+    const Square* getSquare(int x, int y) const;
+
+    /**
+     * @brief Put an item on a square, replacing any item there
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param itemId Catalog item id (ItemCatalog::NONE clears the square's item)
+     *
+     * Squares change only through the Board (or its occupancy layer), so
+     * the packed arrays, spatial index and change log stay in sync.
+     * Out-of-bounds coordinates are ignored, as by the other setters.
+     */
+    void setItem(int x, int y, ItemId itemId);
+
+    /**
+     * @brief Remove the item from a square
+     * @param x X coordinate
+     * @param y Y coordinate
+     */
+    void removeItem(int x, int y);
+
+    /**
+     * @brief Put a new enemy on a square, replacing any enemy there
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param race Race of the enemy
+     * @param health Current health
+     */
+    void setEnemy(int x, int y, Race race, int health);
+
+    /**
+     * @brief Remove the enemy from a square, destroying it
+     * @param x X coordinate
+     * @param y Y coordinate
+     */
+    void removeEnemy(int x, int y);
+
+    /**
+     * @brief Race returned by getEnemyRace() for a square without an enemy
+     */
+    static constexpr Race NO_ENEMY_RACE = static_cast<Race>(BoardOccupancy::NONE);
+
+    /**
+     * @brief Get the race of the enemy on a square
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return Race Race of the enemy, or NO_ENEMY_RACE if the square is off
+     *         the board or holds no enemy (check hasEnemy() first)
+     */
+    Race getEnemyRace(int x, int y) const;
+
+    /**
+     * @brief Get the current health of the enemy on a square
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return int Health, or 0 if the square is off the board or holds no enemy
      */
-    std::shared_ptr<Square> getSquare(int x, int y) const;
+    int getEnemyHealth(int x, int y) const;
+
+    /**
+     * @brief Set the current health of the enemy on a square
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param health New health
+     *
+     * Does nothing if the square is off the board or holds no enemy.
+     */
+    void setEnemyHealth(int x, int y, int health);
+
+    /**
+     * @brief Encode the contents of a square
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return CellRecord Compact record (empty when out of bounds)
+     */
+    CellRecord getCellRecord(int x, int y) const;
 
     /**
      * @brief Get player's current X position
@@ -91,6 +292,144 @@ public:
      * @return std::pair<int, int> (width, height)
      */
     std::pair<int, int> getDimensions() const;
+
+    /**
+     * @brief Check whether the board is backed by a lazily loaded ChunkedWorld
+     * @return bool True for chunked boards
+     */
+    bool isChunked() const;
+
+    /**
+     * @brief Get the chunk store backing a chunked board
+     * @return const ChunkedWorld* Chunk store, or nullptr for dense boards
+     */
+    const ChunkedWorld* getChunkedWorld() const;
+
+    /**
+     * @brief Get the packed occupancy layer mirroring square contents
+     * @return const BoardOccupancy& Occupancy layer (empty for chunked boards)
+     */
+    const BoardOccupancy& getOccupancy() const;
+
+    /**
+     * @brief Count items remaining on the board
+     * @return std::size_t Number of squares holding an item (resident chunks only when chunked)
+     */
+    std::size_t countItems() const;
+
+    /**
+     * @brief Count enemies remaining on the board
+     * @return std::size_t Number of squares holding an enemy (resident chunks only when chunked)
+     */
+    std::size_t countEnemies() const;
+
+    /**
+     * @brief Find the item closest to a position (Manhattan distance)
+     * @param x X coordinate to search from
+     * @param y Y coordinate to search from
+     * @return std::pair<int, int> (x, y) of the nearest item, or (-1, -1) if none
+     *
+     * Answered from the spatial index in logarithmic time. Searches dense
+     * boards only; a chunked board always reports (-1, -1).
+     */
+    std::pair<int, int> findNearestItem(int x, int y) const;
+
+    /**
+     * @brief Find the enemy closest to a position (Manhattan distance)
+     * @param x X coordinate to search from
+     * @param y Y coordinate to search from
+     * @return std::pair<int, int> (x, y) of the nearest enemy, or (-1, -1) if none
+     *
+     * Answered from the spatial index in logarithmic time. Searches dense
+     * boards only; a chunked board always reports (-1, -1).
+     */
+    std::pair<int, int> findNearestEnemy(int x, int y) const;
+
+    /**
+     * @brief Find the k items closest to a position (Manhattan distance)
+     * @param x X coordinate to search from
+     * @param y Y coordinate to search from
+     * @param k Maximum number of items
+     * @return std::vector<std::pair<int, int>> (x, y) of up to k items, nearest first
+     *
+     * Equal distances come out in row-major order. Empty for chunked boards.
+     */
+    std::vector<std::pair<int, int>> findNearestItems(int x, int y, std::size_t k) const;
+
+    /**
+     * @brief Find the k enemies closest to a position (Manhattan distance)
+     * @param x X coordinate to search from
+     * @param y Y coordinate to search from
+     * @param k Maximum number of enemies
+     * @return std::vector<std::pair<int, int>> (x, y) of up to k enemies, nearest first
+     *
+     * Equal distances come out in row-major order. Empty for chunked boards.
+     */
+    std::vector<std::pair<int, int>> findNearestEnemies(int x, int y, std::size_t k) const;
+
+    /**
+     * @brief Find every item inside a rectangle
+     * @param x0 Left column (inclusive)
+     * @param y0 Top row (inclusive)
+     * @param x1 Right column (inclusive)
+     * @param y1 Bottom row (inclusive)
+     * @return std::vector<std::pair<int, int>> (x, y) of the items (empty for chunked boards)
+     */
+    std::vector<std::pair<int, int>> findItemsInRange(int x0, int y0, int x1, int y1) const;
+
+    /**
+     * @brief Find every enemy inside a rectangle
+     * @param x0 Left column (inclusive)
+     * @param y0 Top row (inclusive)
+     * @param x1 Right column (inclusive)
+     * @param y1 Bottom row (inclusive)
+     * @return std::vector<std::pair<int, int>> (x, y) of the enemies (empty for chunked boards)
+     */
+    std::vector<std::pair<int, int>> findEnemiesInRange(int x0, int y0, int x1, int y1) const;
+
+private:
+    /**
+     * @struct PendingEnemy
+     * @brief Enemy found by a bulk fill, registered once every thread has counted its own
+     */
+    struct PendingEnemy {
+        std::uint32_t cell; ///< Row-major cell index
+        CellRecord record;  ///< Race and health of the enemy
+    };
+
+    /**
+     * @brief Fills cells [begin, end) of the grid and lists their enemies in cell order
+     */
+    using RangeFill = std::function<void(std::size_t begin, std::size_t end, std::vector<PendingEnemy>& enemies)>;
+
+    /**
+     * @brief Fill the grid of a dense board without enemies on several threads
+     * @param threads Worker threads (0 = all hardware threads)
+     * @param fillRange Called once per thread, for runs of whole occupancy
+     *        words; sets the run's items and lists its enemies
+     */
+    void fillGrid(unsigned int threads, const RangeFill& fillRange);
+
+    /**
+     * @brief Locate a square together with its occupancy layer and cell
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return SquareRef Location; its square is nullptr if out of bounds
+     *
+     * Loading a chunk does not change the board's observable contents, so
+     * const methods may locate through a chunked world too.
+     */
+    SquareRef locate(int x, int y) const;
+
+    /**
+     * @brief Convert in-bounds coordinates to a row-major storage index
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @return std::size_t Index into squares
+     */
+    std::size_t indexOf(int x, int y) const {
+        return static_cast<std::size_t>(y) * static_cast<std::size_t>(width) + static_cast<std::size_t>(x);
+    }
 };
 
 #endif // BOARD_H
@@ -0,0 +1,180 @@
+/**
+ * @file BoardOccupancy.cpp
+ * @brief Implementation of BoardOccupancy class
+ */
+
+#include "BoardOccupancy.h"
+#include "Square.h"
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+BoardOccupancy::BoardOccupancy(std::size_t cells)
+    : itemBits((cells + 63) / 64, 0), enemyBits((cells + 63) / 64, 0),
+    itemTypes(cells, NONE), enemyRaces(cells, NONE), cellCount(cells) {
+    // Every cell starts empty
+}
+
+void BoardOccupancy::setItem(Square& square, std::size_t cell, ItemId itemId) {
+    if (!ItemCatalog::isValid(itemId)) {
+        removeItem(square, cell);
+        return;
+    }
+    square.item = itemId;
+    setItem(cell, itemId);
+}
+
+void BoardOccupancy::removeItem(Square& square, std::size_t cell) {
+    square.item = ItemCatalog::NONE;
+    clearItem(cell);
+}
+
+void BoardOccupancy::setEnemy(Square& square, std::size_t cell, Race race, int health) {
+    enemies.destroy(square.enemy);
+    square.enemy = enemies.create(race, health, cell);
+    setEnemy(cell, static_cast<std::uint8_t>(race));
+}
+
+void BoardOccupancy::removeEnemy(Square& square, std::size_t cell) {
+    if (square.enemy == EnemyRegistry::NONE) {
+        return;
+    }
+    enemies.destroy(square.enemy);
+    clearEnemy(cell);
+    square.enemy = EnemyRegistry::NONE;
+}
+
+void BoardOccupancy::moveEnemy(Square& from, std::size_t fromCell, Square& to, std::size_t toCell) {
+    if (from.enemy == EnemyRegistry::NONE || fromCell == toCell) {
+        return;
+    }
+    enemies.destroy(to.enemy);
+    enemies.setCell(from.enemy, toCell);
+    setEnemy(toCell, enemyRaces[fromCell]);
+    clearEnemy(fromCell);
+    to.enemy = from.enemy;
+    from.enemy = EnemyRegistry::NONE;
+}
+
+void BoardOccupancy::clearAll(std::vector<Square>& squares) {
+    std::fill(squares.begin(), squares.end(), Square());
+    std::fill(itemBits.begin(), itemBits.end(), 0);
+    std::fill(enemyBits.begin(), enemyBits.end(), 0);
+    std::fill(itemTypes.begin(), itemTypes.end(), NONE);
+    std::fill(enemyRaces.begin(), enemyRaces.end(), NONE);
+    enemies.reset();
+
+    if (itemIndex) {
+        itemIndex->rebuild(itemBits);
+        enemyIndex->rebuild(enemyBits);
+        changeSerial += CHANGE_LOG_SIZE + 1;
+    }
+}
+
+void BoardOccupancy::setItem(std::size_t cell, std::uint8_t itemType) {
+    if (itemIndex && itemTypes[cell] != itemType) {
+        if (!hasItem(cell)) itemIndex->add(cell);
+        recordChange(cell);
+    }
+    itemBits[cell >> 6] |= std::uint64_t(1) << (cell & 63);
+    itemTypes[cell] = itemType;
+}
+
+void BoardOccupancy::clearItem(std::size_t cell) {
+    if (itemIndex && hasItem(cell)) {
+        itemIndex->remove(cell);
+        recordChange(cell);
+    }
+    itemBits[cell >> 6] &= ~(std::uint64_t(1) << (cell & 63));
+    itemTypes[cell] = NONE;
+}
+
+void BoardOccupancy::setEnemy(std::size_t cell, std::uint8_t race) {
+    if (enemyIndex && !hasEnemy(cell)) {
+        enemyIndex->add(cell);
+        recordChange(cell);
+    }
+    enemyBits[cell >> 6] |= std::uint64_t(1) << (cell & 63);
+    enemyRaces[cell] = race;
+}
+
+void BoardOccupancy::clearEnemy(std::size_t cell) {
+    if (enemyIndex && hasEnemy(cell)) {
+        enemyIndex->remove(cell);
+        recordChange(cell);
+    }
+    enemyBits[cell >> 6] &= ~(std::uint64_t(1) << (cell & 63));
+    enemyRaces[cell] = NONE;
+}
+
+void BoardOccupancy::enableSpatialIndex(int width, int height) {
+    itemIndex = std::make_unique<SpatialIndex>(width, height);
+    enemyIndex = std::make_unique<SpatialIndex>(width, height);
+    itemIndex->rebuild(itemBits);
+    enemyIndex->rebuild(enemyBits);
+
+    // Changes made while disabled were not logged: move the serial past
+    // the window so every reader starts over
+    changeLog.assign(CHANGE_LOG_SIZE, 0);
+    changeSerial += CHANGE_LOG_SIZE + 1;
+}
+
+void BoardOccupancy::disableSpatialIndex() {
+    itemIndex.reset();
+    enemyIndex.reset();
+    changeLog.clear();
+}
+
+bool BoardOccupancy::getChangesSince(std::uint64_t serial, std::vector<std::size_t>& cells) const {
+    if (changeLog.empty() || serial > changeSerial || changeSerial - serial > CHANGE_LOG_SIZE) {
+        return false;
+    }
+    for (std::uint64_t i = serial; i < changeSerial; ++i) {
+        cells.push_back(changeLog[i % CHANGE_LOG_SIZE]);
+    }
+    return true;
+}
+
+std::size_t BoardOccupancy::countItems() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : itemBits) {
+        total += popcount(word);
+    }
+    return total;
+}
+
+std::size_t BoardOccupancy::countEnemies() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : enemyBits) {
+        total += popcount(word);
+    }
+    return total;
+}
+
+std::size_t BoardOccupancy::countOccupied() const {
+    std::size_t total = 0;
+    for (std::size_t w = 0; w < itemBits.size(); ++w) {
+        total += popcount(itemBits[w] | enemyBits[w]);
+    }
+    return total;
+}
+
+int BoardOccupancy::popcount(std::uint64_t word) {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+int BoardOccupancy::lowestBit(std::uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
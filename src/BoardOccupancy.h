@@ -0,0 +1,305 @@
+/**
+ * @file BoardOccupancy.h
+ * @brief Structure-of-arrays occupancy layer for board contents
+ */
+
+#ifndef BOARDOCCUPANCY_H
+#define BOARDOCCUPANCY_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include "SpatialIndex.h"
+#include "EnemyRegistry.h"
+#include "ItemCatalog.h"
+
+class Square;
+
+/**
+ * @class BoardOccupancy
+ * @brief Packed per-cell summary of what every square contains
+ *
+ * Mirrors the contents of a grid of squares in parallel arrays:
+ * one bit per cell for items, one bit per cell for enemies, a byte per
+ * cell holding the item type id and a byte per cell holding the enemy
+ * race code. Square contents change only through the square-level
+ * calls below, which update the square and the arrays together, so
+ * whole-map queries can run over a few packed words instead of touching
+ * every Square object.
+ *
+ * A layer can also keep a SpatialIndex of its items and of its enemies,
+ * updated on the same calls, for nearest and range queries, and a log of
+ * the most recent cells whose contents changed, so caches built on the
+ * board (see Pathfinder) can repair just what moved.
+ *
+ * The layer also owns the EnemyRegistry holding the enemies of its grid;
+ * squares refer to them by handle.
+ */
+class BoardOccupancy {
+private:
+    std::vector<std::uint64_t> itemBits;
+    std::vector<std::uint64_t> enemyBits;
+    std::vector<std::uint8_t> itemTypes;
+    std::vector<std::uint8_t> enemyRaces;
+    std::size_t cellCount;
+    std::unique_ptr<SpatialIndex> itemIndex;  // Set while indexing is enabled
+    std::unique_ptr<SpatialIndex> enemyIndex;
+    std::vector<std::size_t> changeLog;      // Ring of the last CHANGE_LOG_SIZE changed cells
+    std::uint64_t changeSerial = 0;          // Changes logged so far
+    EnemyRegistry enemies;
+
+    /**
+     * @brief Append a cell to the change log
+     * @param cell Row-major cell index
+     */
+    void recordChange(std::size_t cell) {
+        changeLog[changeSerial++ % CHANGE_LOG_SIZE] = cell;
+    }
+
+public:
+    /**
+     * @brief Marker stored in the per-cell byte arrays for "nothing here"
+     */
+    static constexpr std::uint8_t NONE = 0xFF;
+
+    /**
+     * @brief Number of changed cells the change log remembers
+     */
+    static constexpr std::size_t CHANGE_LOG_SIZE = 4096;
+
+    /**
+     * @brief Constructor for BoardOccupancy
+     * @param cells Number of cells tracked (all start empty)
+     */
+    explicit BoardOccupancy(std::size_t cells);
+
+    /**
+     * @brief Put an item on a square of this layer, replacing any item there
+     * @param square Square stored at the cell
+     * @param cell Row-major cell index of the square
+     * @param itemId Catalog item id (invalid ids, including ItemCatalog::NONE, clear the item)
+     */
+    void setItem(Square& square, std::size_t cell, ItemId itemId);
+
+    /**
+     * @brief Remove the item from a square of this layer
+     * @param square Square stored at the cell
+     * @param cell Row-major cell index of the square
+     */
+    void removeItem(Square& square, std::size_t cell);
+
+    /**
+     * @brief Put a new enemy on a square of this layer, replacing any enemy there
+     * @param square Square stored at the cell
+     * @param cell Row-major cell index of the square
+     * @param race Race of the enemy
+     * @param health Current health
+     */
+    void setEnemy(Square& square, std::size_t cell, Race race, int health);
+
+    /**
+     * @brief Remove the enemy from a square of this layer, destroying it
+     * @param square Square stored at the cell
+     * @param cell Row-major cell index of the square
+     */
+    void removeEnemy(Square& square, std::size_t cell);
+
+    /**
+     * @brief Move an enemy to another square of this layer, replacing any enemy there
+     * @param from Square holding the enemy
+     * @param fromCell Row-major cell index of from
+     * @param to Destination square
+     * @param toCell Row-major cell index of to
+     *
+     * The enemy keeps its handle; only its position and the race codes change.
+     */
+    void moveEnemy(Square& from, std::size_t fromCell, Square& to, std::size_t toCell);
+
+    /**
+     * @brief Empty every square of the grid at once
+     * @param squares The grid this layer mirrors (one square per cell)
+     *
+     * Clears the packed arrays and resets the enemy registry in one go
+     * instead of destroying enemies one by one. No EnemyHandle into this
+     * layer survives: handles held anywhere but in these squares become
+     * meaningless. A spatial index is rebuilt empty and the change log
+     * restarts, as after enableSpatialIndex().
+     */
+    void clearAll(std::vector<Square>& squares);
+
+    /**
+     * @brief Record that a cell now holds an item
+     * @param cell Row-major cell index
+     * @param itemType Item type id of the item
+     */
+    void setItem(std::size_t cell, std::uint8_t itemType);
+
+    /**
+     * @brief Record that a cell no longer holds an item
+     * @param cell Row-major cell index
+     */
+    void clearItem(std::size_t cell);
+
+    /**
+     * @brief Record that a cell now holds an enemy
+     * @param cell Row-major cell index
+     * @param race Race code of the enemy
+     */
+    void setEnemy(std::size_t cell, std::uint8_t race);
+
+    /**
+     * @brief Record that a cell no longer holds an enemy
+     * @param cell Row-major cell index
+     */
+    void clearEnemy(std::size_t cell);
+
+    /**
+     * @brief Check whether a cell holds an item
+     * @param cell Row-major cell index
+     * @return bool True if an item is present
+     */
+    bool hasItem(std::size_t cell) const {
+        return (itemBits[cell >> 6] >> (cell & 63)) & 1u;
+    }
+
+    /**
+     * @brief Check whether a cell holds an enemy
+     * @param cell Row-major cell index
+     * @return bool True if an enemy is present
+     */
+    bool hasEnemy(std::size_t cell) const {
+        return (enemyBits[cell >> 6] >> (cell & 63)) & 1u;
+    }
+
+    /**
+     * @brief Get the item type id stored for a cell
+     * @param cell Row-major cell index
+     * @return std::uint8_t Item type id, or NONE
+     */
+    std::uint8_t getItemType(std::size_t cell) const { return itemTypes[cell]; }
+
+    /**
+     * @brief Get the enemy race code stored for a cell
+     * @param cell Row-major cell index
+     * @return std::uint8_t Race code, or NONE
+     */
+    std::uint8_t getEnemyRace(std::size_t cell) const { return enemyRaces[cell]; }
+
+    /**
+     * @brief Count cells holding an item
+     * @return std::size_t Number of items on the grid
+     */
+    std::size_t countItems() const;
+
+    /**
+     * @brief Count cells holding an enemy
+     * @return std::size_t Number of enemies on the grid
+     */
+    std::size_t countEnemies() const;
+
+    /**
+     * @brief Count cells holding an item, an enemy or both
+     * @return std::size_t Number of non-empty cells
+     */
+    std::size_t countOccupied() const;
+
+    /**
+     * @brief Get the number of cells tracked
+     * @return std::size_t Cell count
+     */
+    std::size_t size() const { return cellCount; }
+
+    /**
+     * @brief Get the packed item bitset (bit i of word w is cell w * 64 + i)
+     * @return const std::vector<std::uint64_t>& Item bits
+     */
+    const std::vector<std::uint64_t>& getItemBits() const { return itemBits; }
+
+    /**
+     * @brief Get the packed enemy bitset (bit i of word w is cell w * 64 + i)
+     * @return const std::vector<std::uint64_t>& Enemy bits
+     */
+    const std::vector<std::uint64_t>& getEnemyBits() const { return enemyBits; }
+
+    /**
+     * @brief Build spatial indexes of the items and enemies and keep them updated
+     * @param width Grid width (cells are row-major, index = y * width + x)
+     * @param height Grid height
+     *
+     * Updates cost O(log cells) from then on, so bulk fills spread over
+     * threads should run with indexing disabled and enable it afterwards.
+     * Also starts the change log; earlier serials are no longer covered.
+     */
+    void enableSpatialIndex(int width, int height);
+
+    /**
+     * @brief Drop the spatial indexes and change log; updates touch only the packed arrays again
+     */
+    void disableSpatialIndex();
+
+    /**
+     * @brief Get the number of changes logged so far
+     * @return std::uint64_t Serial to pass to getChangesSince() later
+     */
+    std::uint64_t getChangeSerial() const { return changeSerial; }
+
+    /**
+     * @brief List the cells changed since a serial
+     * @param serial Value of getChangeSerial() when the caller last looked
+     * @param cells Receives the changed cells, oldest first (may repeat)
+     * @return bool False if the log no longer covers that serial (or indexing
+     *         is disabled); the caller must then rebuild from scratch
+     */
+    bool getChangesSince(std::uint64_t serial, std::vector<std::size_t>& cells) const;
+
+    /**
+     * @brief Get the item index
+     * @return const SpatialIndex* Index, or nullptr while indexing is disabled
+     */
+    const SpatialIndex* getItemIndex() const { return itemIndex.get(); }
+
+    /**
+     * @brief Get the enemy index
+     * @return const SpatialIndex* Index, or nullptr while indexing is disabled
+     */
+    const SpatialIndex* getEnemyIndex() const { return enemyIndex.get(); }
+
+    /**
+     * @brief Get the registry owning the enemies on this layer's cells
+     * @return EnemyRegistry& Enemy registry
+     */
+    EnemyRegistry& getEnemies() { return enemies; }
+
+    /**
+     * @brief Get the registry owning the enemies on this layer's cells (read-only)
+     * @return const EnemyRegistry& Enemy registry
+     */
+    const EnemyRegistry& getEnemies() const { return enemies; }
+
+    /**
+     * @brief Count the set bits of a 64-bit word
+     * @param word Word to count
+     * @return int Number of set bits
+     */
+    static int popcount(std::uint64_t word);
+
+    /**
+     * @brief Index of the lowest set bit of a non-zero word
+     * @param word Non-zero word
+     * @return int Bit position (0-63)
+     */
+    static int lowestBit(std::uint64_t word);
+};
+
+/**
+ * @struct SquareRef
+ * @brief A square together with the occupancy layer and cell it belongs to
+ */
+struct SquareRef {
+    Square* square;         ///< Square, or nullptr when the location is off the board
+    BoardOccupancy* layer;  ///< Layer holding the square's cell
+    std::size_t cell;       ///< Row-major index of the square within the layer
+};
+
+#endif // BOARDOCCUPANCY_H
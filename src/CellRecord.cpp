@@ -0,0 +1,37 @@
+/**
+ * @file CellRecord.cpp
+ * @brief Implementation of CellRecord encoding
+ */
+
+#include "CellRecord.h"
+#include "RaceTraits.h"
+
+CellRecord CellRecord::fromSquare(const Square& square, const EnemyRegistry& enemies) {
+    CellRecord record = {BoardOccupancy::NONE, BoardOccupancy::NONE, 0};
+    record.itemType = square.getItemId();
+    if (square.hasEnemy()) {
+        record.enemyRace = static_cast<std::uint8_t>(enemies.getRace(square.getEnemy()));
+        record.enemyHealth = static_cast<std::int16_t>(enemies.getHealth(square.getEnemy()));
+    }
+    return record;
+}
+
+void CellRecord::applyTo(Square& square, BoardOccupancy& layer, std::size_t cell) const {
+    // Invalid ids (including NONE) clear the square's item
+    layer.setItem(square, cell, static_cast<ItemId>(itemType));
+    if (enemyRace != BoardOccupancy::NONE) {
+        layer.setEnemy(square, cell, static_cast<Race>(enemyRace), enemyHealth);
+    } else {
+        layer.removeEnemy(square, cell);
+    }
+}
+
+bool CellRecord::isValid() const {
+    if (itemType != BoardOccupancy::NONE && !ItemCatalog::isValid(static_cast<ItemId>(itemType))) {
+        return false;
+    }
+    if (enemyRace == BoardOccupancy::NONE) {
+        return enemyHealth == 0;
+    }
+    return enemyRace < RACE_COUNT && enemyHealth > 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file CellRecord.h
+ * @brief Compact fixed-size encoding of a square's contents
+ */
+
+#ifndef CELLRECORD_H
+#define CELLRECORD_H
+
+#include <cstdint>
+#include "Square.h"
+#include "BoardOccupancy.h"
+
+/**
+ * @struct CellRecord
+ * @brief Four-byte value snapshot of one square
+ *
+ * Holds the item type id, the enemy race code and the enemy's current
+ * health, which is everything needed to rebuild a stock square. Used to
+ * persist squares outside the live grid.
+ */
+struct CellRecord {
+    std::uint8_t itemType;     ///< Item type id, or BoardOccupancy::NONE
+    std::uint8_t enemyRace;    ///< Race code, or BoardOccupancy::NONE
+    std::int16_t enemyHealth;  ///< Enemy health (0 when there is no enemy)
+
+    /**
+     * @brief Encode the contents of a square
+     * @param square Square to encode
+     * @param enemies Registry of the square's occupancy layer
+     * @return CellRecord Compact record
+     */
+    static CellRecord fromSquare(const Square& square, const EnemyRegistry& enemies);
+
+    /**
+     * @brief Replace the contents of a square with this record
+     * @param square Square to overwrite
+     * @param layer Occupancy layer of the square
+     * @param cell Row-major cell index of the square within the layer
+     */
+    void applyTo(Square& square, BoardOccupancy& layer, std::size_t cell) const;
+
+    /**
+     * @brief Check that the record describes contents a square can hold
+     * @return bool True if the item is a catalog id or NONE, and the enemy is
+     *         either absent (health 0) or of a valid race with positive health
+     *
+     * Records read from files nobody vouches for (see WorldFile) must pass
+     * this before they reach a board.
+     */
+    bool isValid() const;
+
+    bool operator==(const CellRecord& other) const {
+        return itemType == other.itemType && enemyRace == other.enemyRace &&
+               enemyHealth == other.enemyHealth;
+    }
+
+    bool operator!=(const CellRecord& other) const {
+        return !(*this == other);
+    }
+};
+
+#endif // CELLRECORD_H
@@ -14,25 +14,25 @@ Character::Character(std::string charName, int baseAttack, int baseDefence,
 
 int Character::getAttack() const {
     // Calculate total attack including item modifications
-    auto mods = inventory.getTotalModifications();
+    const auto& mods = inventory.getTotalModifications();
     return attack + mods.attack;
 }
 
 int Character::getDefence() const {
     // Calculate total defence including item modifications
-    auto mods = inventory.getTotalModifications();
+    const auto& mods = inventory.getTotalModifications();
     return defence + mods.defence;
 }
 
 int Character::getHealth() const {
     // Calculate total health including item modifications
-    auto mods = inventory.getTotalModifications();
+    const auto& mods = inventory.getTotalModifications();
     return health + mods.health;
 }
 
 int Character::getStrength() const {
     // Calculate total strength including item modifications
-    auto mods = inventory.getTotalModifications();
+    const auto& mods = inventory.getTotalModifications();
     return strength + mods.strength;
 }
 
@@ -61,3 +61,7 @@ int Character::getGoldValue() const {
 Inventory& Character::getInventory() {
     return inventory;
 }
+
+const Inventory& Character::getInventory() const {
+    return inventory;
+}
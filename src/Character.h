@@ -8,8 +8,23 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 #include "Inventory.h"
 
+/**
+ * @enum Race
+ * @brief Compact identifier for each playable/enemy race
+ *
+ * Values double as the race codes stored in the board's occupancy layer.
+ */
+enum class Race : std::uint8_t {
+    Human = 0,
+    Elf = 1,
+    Dwarf = 2,
+    Hobbit = 3,
+    Orc = 4
+};
+
 /**
  * @class Character
  * @brief Abstract base class representing any character in the game
@@ -88,9 +103,11 @@ public:
      * @param damage The potential damage from the attack
      * @param attackerAttack The attacker's attack value
      * @param isDaytime Current time of day
+     * @param effectRoll Uniform random value in [0, 1) for races with random effects
      * @return int Actual damage taken after defence
      */
-    virtual int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const = 0;
+    virtual int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                         double effectRoll) const = 0;
 
     /**
      * @brief Take damage from an attack
@@ -116,6 +133,12 @@ public:
      */
     virtual std::string getRace() const = 0;
 
+    /**
+     * @brief Get character's race as a compact identifier
+     * @return Race Race enum value
+     */
+    virtual Race getRaceId() const = 0;
+
     /**
      * @brief Get gold value when defeated
      * @return int Gold awarded to victor
@@ -127,6 +150,12 @@ public:
      * @return Reference to inventory object
      */
     virtual Inventory& getInventory();
+
+    /**
+     * @brief Get character's inventory (read-only)
+     * @return Const reference to inventory object
+     */
+    const Inventory& getInventory() const;
 };
 
 #endif // CHARACTER_H
@@ -0,0 +1,208 @@
+/**
+ * @file ChunkedWorld.cpp
+ * @brief Implementation of ChunkedWorld class
+ */
+
+#include "ChunkedWorld.h"
+#include "Board.h"
+#include <algorithm>
+
+ChunkedWorld::ChunkedWorld(std::uint64_t worldSeed, int worldWidth, int worldHeight, std::size_t memoryBudget,
+                           int playerStartX, int playerStartY)
+    : seed(worldSeed), width(worldWidth), height(worldHeight), startX(playerStartX), startY(playerStartY),
+    budget(memoryBudget), savedBytes(0), lastChunk(nullptr) {
+    // Chunks are created lazily on first access
+}
+
+ChunkedWorld::ChunkedWorld(std::shared_ptr<const WorldFile> file, std::size_t memoryBudget)
+    : seed(file->getHeader().boardSeed), source(std::move(file)),
+    width(source->getHeader().width), height(source->getHeader().height),
+    startX(source->getHeader().playerX), startY(source->getHeader().playerY),
+    budget(memoryBudget), savedBytes(0), lastChunk(nullptr) {
+    // Nothing is read from the file until a chunk is first accessed
+}
+
+Square& ChunkedWorld::getSquare(int x, int y) {
+    return *locate(x, y).square;
+}
+
+SquareRef ChunkedWorld::locate(int x, int y) {
+    const int chunkX = x / CHUNK_SIZE;
+    const int chunkY = y / CHUNK_SIZE;
+    const std::size_t cell = static_cast<std::size_t>(y % CHUNK_SIZE) * CHUNK_SIZE +
+                             static_cast<std::size_t>(x % CHUNK_SIZE);
+
+    Chunk& chunk = (lastChunk && lastChunk->key == makeKey(chunkX, chunkY)) ? *lastChunk : loadChunk(chunkX, chunkY);
+    return SquareRef{&chunk.squares[cell], &chunk.occupancy, cell};
+}
+
+void ChunkedWorld::reset(std::uint64_t worldSeed) {
+    seed = worldSeed;
+    lru.clear();
+    resident.clear();
+    saved.clear();
+    savedBytes = 0;
+    lastChunk = nullptr;
+}
+
+std::size_t ChunkedWorld::getResidentChunkCount() const {
+    return resident.size();
+}
+
+std::size_t ChunkedWorld::getSavedChunkCount() const {
+    return saved.size();
+}
+
+std::size_t ChunkedWorld::getSavedBytes() const {
+    return savedBytes;
+}
+
+std::size_t ChunkedWorld::getChunkCapacity() const {
+    const std::size_t left = budget > savedBytes ? budget - savedBytes : 0;
+    return std::max<std::size_t>(2, left / estimatedChunkBytes());
+}
+
+std::size_t ChunkedWorld::countResidentItems() const {
+    std::size_t total = 0;
+    for (const auto& chunk : lru) {
+        total += chunk->occupancy.countItems();
+    }
+    return total;
+}
+
+std::size_t ChunkedWorld::countResidentEnemies() const {
+    std::size_t total = 0;
+    for (const auto& chunk : lru) {
+        total += chunk->occupancy.countEnemies();
+    }
+    return total;
+}
+
+std::size_t ChunkedWorld::estimatedChunkBytes() {
+    // Square storage, occupancy arrays and baseline records per cell; items
+    // are one-byte ids inside the square, so they need nothing more
+    std::size_t perCell = sizeof(Square) + sizeof(CellRecord) + 2 * sizeof(std::uint8_t) + 1;
+    // Expected enemies: 20% of cells, each a registry entry
+    std::size_t enemies = CHUNK_CELLS / 5 * EnemyRegistry::BYTES_PER_ENEMY;
+    return sizeof(Chunk) + CHUNK_CELLS * perCell + enemies;
+}
+
+ChunkedWorld::Chunk& ChunkedWorld::loadChunk(int chunkX, int chunkY) {
+    const std::uint64_t key = makeKey(chunkX, chunkY);
+
+    auto found = resident.find(key);
+    if (found != resident.end()) {
+        // Cache hit: move to the front of the LRU list
+        lru.splice(lru.begin(), lru, found->second);
+        lastChunk = lru.front().get();
+        return *lastChunk;
+    }
+
+    // Reuse an evicted chunk's storage when the cache is full, otherwise
+    // allocate. Saved changes shrink the capacity as they grow, so a full
+    // cache may have to give up more than one chunk
+    std::unique_ptr<Chunk> chunk;
+    if (resident.size() >= getChunkCapacity()) {
+        chunk = evictOldest();
+        while (resident.size() >= getChunkCapacity()) {
+            evictOldest();
+        }
+    } else {
+        chunk = std::make_unique<Chunk>();
+    }
+
+    chunk->key = key;
+    populateChunk(*chunk, chunkX, chunkY);
+
+    lru.push_front(std::move(chunk));
+    resident[key] = lru.begin();
+    lastChunk = lru.front().get();
+    return *lastChunk;
+}
+
+void ChunkedWorld::populateChunk(Chunk& chunk, int chunkX, int chunkY) {
+    // Squares past the board's edge stay empty in both the chunk and its baseline
+    const int originX = chunkX * CHUNK_SIZE;
+    const int originY = chunkY * CHUNK_SIZE;
+    const int cols = std::min(CHUNK_SIZE, width - originX);
+    const int rows = std::min(CHUNK_SIZE, height - originY);
+    const CellRecord empty = {BoardOccupancy::NONE, BoardOccupancy::NONE, 0};
+    chunk.baseline.assign(chunk.squares.size(), empty);
+
+    if (source) {
+        // Never modified: copy from the mapped file. The file is only
+        // checked as chunks are copied, so open() stays O(1); a corrupt
+        // record loads as an empty square
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 0; col < cols; ++col) {
+                const std::size_t cell = static_cast<std::size_t>(row) * CHUNK_SIZE + col;
+                const CellRecord& stored = source->getCell(originX + col, originY + row);
+                const CellRecord record = stored.isValid() ? stored : empty;
+                if (record.itemType != BoardOccupancy::NONE || record.enemyRace != BoardOccupancy::NONE) {
+                    record.applyTo(chunk.squares[cell], chunk.occupancy, cell);
+                }
+                chunk.baseline[cell] = record;
+            }
+        }
+    } else {
+        // Never modified: generate with the same rules as a dense board
+        const CounterRng rng(seed);
+
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 0; col < cols; ++col) {
+                const int x = originX + col;
+                const int y = originY + row;
+                const std::size_t cell = static_cast<std::size_t>(row) * CHUNK_SIZE + col;
+                if (!(x == startX && y == startY)) {
+                    Board::populateSquare(chunk.squares[cell], chunk.occupancy, cell, rng, x, y);
+                }
+                chunk.baseline[cell] = CellRecord::fromSquare(chunk.squares[cell], chunk.occupancy.getEnemies());
+            }
+        }
+    }
+
+    // Modified earlier: replay the saved changes over the generated state.
+    // They stay saved, so the chunk survives later evictions unchanged
+    auto savedChunk = saved.find(chunk.key);
+    if (savedChunk != saved.end()) {
+        for (const CellChange& change : savedChunk->second) {
+            change.record.applyTo(chunk.squares[change.cell], chunk.occupancy, change.cell);
+        }
+    }
+}
+
+std::unique_ptr<ChunkedWorld::Chunk> ChunkedWorld::evictOldest() {
+    std::unique_ptr<Chunk> victim = std::move(lru.back());
+    lru.pop_back();
+    Chunk& chunk = *victim;
+
+    // Persist only the squares that differ from the generated state; a
+    // chunk changed back to it needs no saved changes at all
+    std::vector<CellChange> changes;
+    for (std::size_t i = 0; i < chunk.squares.size(); ++i) {
+        const CellRecord current = CellRecord::fromSquare(chunk.squares[i], chunk.occupancy.getEnemies());
+        if (current != chunk.baseline[i]) {
+            changes.push_back(CellChange{static_cast<std::uint16_t>(i), current});
+        }
+    }
+    auto previous = saved.find(chunk.key);
+    if (previous != saved.end()) {
+        savedBytes -= savedChunkBytes(previous->second.size());
+        saved.erase(previous);
+    }
+    if (!changes.empty()) {
+        changes.shrink_to_fit();
+        savedBytes += savedChunkBytes(changes.size());
+        saved.emplace(chunk.key, std::move(changes));
+    }
+
+    // Empty the squares so the storage can be reused for the next chunk;
+    // the chunk's enemy handles live only in its squares, so none survives
+    chunk.occupancy.clearAll(chunk.squares);
+
+    resident.erase(chunk.key);
+    if (lastChunk == &chunk) {
+        lastChunk = nullptr;
+    }
+    return victim;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file ChunkedWorld.h
+ * @brief Lazily generated, chunk-cached square storage for very large boards
+ */
+
+#ifndef CHUNKEDWORLD_H
+#define CHUNKEDWORLD_H
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Square.h"
+#include "BoardOccupancy.h"
+#include "CellRecord.h"
+#include "WorldFile.h"
+
+/**
+ * @class ChunkedWorld
+ * @brief Backing store that generates 64x64 chunks of squares on demand
+ *
+ * A chunk is generated the first time one of its squares is requested,
+ * using the same per-cell rules and seed as Board::initializeBoard(), so
+ * a chunked world is cell-for-cell identical to a dense board with the
+ * same seed. Resident chunks live in an LRU cache bounded by a memory
+ * budget. When a chunk is evicted it is compared with its generated state
+ * and only the squares that changed (item picked up or dropped, enemy
+ * damaged or killed) are kept, as six-byte CellChanges; the rest of the
+ * chunk is regenerated next time. Saved changes count against the same
+ * budget, so the more a session has changed, the fewer chunks stay
+ * resident, down to a floor of two. Past that point memory grows only by
+ * the changes themselves, six bytes per changed square.
+ *
+ * A world can instead be backed by a WorldFile: chunks are then copied
+ * from the mapped file rather than generated, and the same eviction rules
+ * keep a session's changes in its own saved records, never in the file.
+ */
+class ChunkedWorld {
+public:
+    /**
+     * @brief Side length of a chunk in squares
+     */
+    static constexpr int CHUNK_SIZE = 64;
+
+    /**
+     * @brief Number of squares in a chunk
+     */
+    static constexpr int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+    /**
+     * @brief Constructor for ChunkedWorld
+     * @param worldSeed Seed for chunk generation
+     * @param worldWidth Width of the board; cells of edge chunks past it stay empty
+     * @param worldHeight Height of the board
+     * @param memoryBudget Approximate bytes resident chunks and saved changes may use
+     * @param playerStartX X coordinate left empty for the player's start
+     * @param playerStartY Y coordinate left empty for the player's start
+     */
+    ChunkedWorld(std::uint64_t worldSeed, int worldWidth, int worldHeight, std::size_t memoryBudget,
+                 int playerStartX, int playerStartY);
+
+    /**
+     * @brief Constructor for a ChunkedWorld read from a pre-built world file
+     * @param file Mapped world shared with any other boards using it
+     * @param memoryBudget Approximate bytes resident chunks and saved changes may use
+     */
+    ChunkedWorld(std::shared_ptr<const WorldFile> file, std::size_t memoryBudget);
+
+    /**
+     * @brief Get the square at absolute coordinates, loading its chunk if needed
+     * @param x X coordinate (must be non-negative)
+     * @param y Y coordinate (must be non-negative)
+     * @return Square& Square inside a resident chunk
+     *
+     * The reference stays valid until a later call loads another chunk and
+     * the cache has to evict this one. Eviction resets the chunk's enemy
+     * registry, so enemy handles read from its squares must not be kept past it.
+     */
+    Square& getSquare(int x, int y);
+
+    /**
+     * @brief Locate the square at absolute coordinates, loading its chunk if needed
+     * @param x X coordinate (must be non-negative)
+     * @param y Y coordinate (must be non-negative)
+     * @return SquareRef Square with its chunk's occupancy layer and cell, valid as for getSquare()
+     */
+    SquareRef locate(int x, int y);
+
+    /**
+     * @brief Drop all resident and saved chunks and switch to a new seed
+     * @param worldSeed Seed for chunk generation
+     */
+    void reset(std::uint64_t worldSeed);
+
+    /**
+     * @brief Get the number of chunks currently resident in memory
+     * @return std::size_t Resident chunk count
+     */
+    std::size_t getResidentChunkCount() const;
+
+    /**
+     * @brief Get the number of modified chunks saved after eviction
+     * @return std::size_t Saved chunk count
+     */
+    std::size_t getSavedChunkCount() const;
+
+    /**
+     * @brief Get the bytes used by the changes saved from evicted chunks
+     * @return std::size_t Estimated saved bytes
+     */
+    std::size_t getSavedBytes() const;
+
+    /**
+     * @brief Get the maximum number of chunks kept resident
+     * @return std::size_t Cache capacity in chunks: what the budget leaves
+     *         after saved changes, but at least two
+     */
+    std::size_t getChunkCapacity() const;
+
+    /**
+     * @brief Count items in resident chunks
+     * @return std::size_t Number of items
+     */
+    std::size_t countResidentItems() const;
+
+    /**
+     * @brief Count enemies in resident chunks
+     * @return std::size_t Number of enemies
+     */
+    std::size_t countResidentEnemies() const;
+
+    /**
+     * @brief Estimated resident memory of one chunk, used to size the cache
+     * @return std::size_t Bytes per chunk
+     */
+    static std::size_t estimatedChunkBytes();
+
+private:
+    /**
+     * @struct CellChange
+     * @brief A square of an evicted chunk that differs from its generated state
+     */
+    struct CellChange {
+        std::uint16_t cell; ///< Cell index within the chunk
+        CellRecord record;  ///< Contents of the square when the chunk was evicted
+    };
+
+    /**
+     * @brief Estimated bytes of one saved chunk beyond its changes (map node, vector)
+     */
+    static constexpr std::size_t SAVED_CHUNK_OVERHEAD = 64;
+
+    /**
+     * @struct Chunk
+     * @brief One resident 64x64 block of squares
+     */
+    struct Chunk {
+        std::uint64_t key;
+        std::vector<Square> squares;
+        BoardOccupancy occupancy;
+        std::vector<CellRecord> baseline; // Contents as generated or read from the file
+
+        Chunk() : key(0), squares(CHUNK_CELLS), occupancy(CHUNK_CELLS) {}
+    };
+
+    using ChunkList = std::list<std::unique_ptr<Chunk>>;
+
+    std::uint64_t seed;
+    std::shared_ptr<const WorldFile> source; // Set for file-backed worlds
+    int width;
+    int height;
+    int startX;
+    int startY;
+    std::size_t budget;
+    std::size_t savedBytes; // Estimated memory held by the saved changes
+    ChunkList lru; // Most recently used chunk at the front
+    std::unordered_map<std::uint64_t, ChunkList::iterator> resident;
+    std::unordered_map<std::uint64_t, std::vector<CellChange>> saved;
+    Chunk* lastChunk; // Fast path for repeated access to the same chunk
+
+    /**
+     * @brief Pack chunk coordinates into a map key
+     */
+    static std::uint64_t makeKey(int chunkX, int chunkY) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunkY)) << 32) |
+               static_cast<std::uint32_t>(chunkX);
+    }
+
+    /**
+     * @brief Find or load the chunk at the given chunk coordinates
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     * @return Chunk& Resident chunk
+     */
+    Chunk& loadChunk(int chunkX, int chunkY);
+
+    /**
+     * @brief Estimated bytes a saved chunk holding some changes uses
+     */
+    static std::size_t savedChunkBytes(std::size_t changes) {
+        return SAVED_CHUNK_OVERHEAD + changes * sizeof(CellChange);
+    }
+
+    /**
+     * @brief Fill a chunk by generation (or from the file), then apply its saved changes
+     * @param chunk Chunk to fill (squares must be empty)
+     * @param chunkX Chunk column
+     * @param chunkY Chunk row
+     */
+    void populateChunk(Chunk& chunk, int chunkX, int chunkY);
+
+    /**
+     * @brief Evict the least recently used chunk, saving it if modified
+     * @return std::unique_ptr<Chunk> The emptied chunk, ready for reuse
+     */
+    std::unique_ptr<Chunk> evictOldest();
+};
+
+#endif // CHUNKEDWORLD_H
@@ -4,19 +4,76 @@
  */
 
 #include "Combat.h"
+#include "CombatKernel.h"
+#include <array>
+#include <utility>
 
-Combat::Combat() : gen(rd()) {
+namespace {
+
+using SequenceFunction = void (*)(Character&, Character&, bool, const CombatRoll*, std::size_t,
+                                  Combat::RoundResult*);
+
+constexpr int RACE_PAIRS = RACE_COUNT * RACE_COUNT;
+
+/**
+ * @brief Build the jump table of specialized rounds, indexed attacker * RACE_COUNT + defender
+ */
+template <std::size_t... Pair>
+constexpr std::array<Combat::RoundFunction, RACE_PAIRS> makeRoundTable(std::index_sequence<Pair...>) {
+    return {{&CombatKernel<static_cast<Race>(Pair / RACE_COUNT),
+                           static_cast<Race>(Pair % RACE_COUNT)>::executeRound...}};
+}
+
+/**
+ * @brief Build the jump table of specialized round loops
+ */
+template <std::size_t... Pair>
+constexpr std::array<SequenceFunction, RACE_PAIRS> makeSequenceTable(std::index_sequence<Pair...>) {
+    return {{&CombatKernel<static_cast<Race>(Pair / RACE_COUNT),
+                           static_cast<Race>(Pair % RACE_COUNT)>::executeSequence...}};
+}
+
+constexpr std::array<Combat::RoundFunction, RACE_PAIRS> ROUND_TABLE =
+    makeRoundTable(std::make_index_sequence<RACE_PAIRS>{});
+constexpr std::array<SequenceFunction, RACE_PAIRS> SEQUENCE_TABLE =
+    makeSequenceTable(std::make_index_sequence<RACE_PAIRS>{});
+
+/**
+ * @brief Jump table index of a race pair
+ */
+inline int pairIndex(Race attacker, Race defender) {
+    return static_cast<int>(attacker) * RACE_COUNT + static_cast<int>(defender);
+}
+
+} // namespace
+
+Combat::Combat() : rng(Rng::fromEntropy()) {
     // Initialize random number generator
 }
 
-std::pair<bool, int> Combat::executeCombatRound(std::shared_ptr<Character> attacker,
-                                                std::shared_ptr<Character> defender,
-                                                bool isDaytime) {
+Combat::Combat(Rng generator) : rng(generator) {
+    // Rolls are reproducible from the generator's seed
+}
+
+Rng& Combat::getRng() {
+    return rng;
+}
+
+Combat::RoundResult Combat::executeCombatRound(Character& attacker, Character& defender, bool isDaytime) {
+    CombatRoll roll;
+    roll.attack = rng.nextUnit();
+    roll.defence = rng.nextUnit();
+    roll.effect = rng.nextUnit();
+    return executeCombatRound(attacker, defender, isDaytime, roll);
+}
+
+Combat::RoundResult Combat::executeCombatRound(Character& attacker, Character& defender, bool isDaytime,
+                                              const CombatRoll& roll) {
     int goldEarned = 0;
 
     // Step 1: Check if attacker's attack succeeds
-    double attackProbability = attacker->getAttackChance(isDaytime);
-    bool attackSucceeded = checkSuccess(attackProbability);
+    double attackProbability = attacker.getAttackChance(isDaytime);
+    bool attackSucceeded = roll.attack <= attackProbability;
 
     if (!attackSucceeded) {
         // Attack failed - combat round ends
@@ -24,49 +81,68 @@ std::pair<bool, int> Combat::executeCombatRound(std::shared_ptr<Character> attac
     }
 
     // Step 2: Attack succeeded, now check defender's defence
-    double defenceProbability = defender->getDefenceChance(isDaytime);
-    bool defenceSucceeded = checkSuccess(defenceProbability);
+    double defenceProbability = defender.getDefenceChance(isDaytime);
+    bool defenceSucceeded = roll.defence <= defenceProbability;
 
     int damage = 0;
 
     if (!defenceSucceeded) {
         // Defence failed - apply full damage
-        damage = calculateDamage(attacker->getAttack(), defender->getDefence());
-        defender->takeDamage(damage);
+        damage = calculateDamage(attacker.getAttack(), defender.getDefence());
+        defender.takeDamage(damage);
     } else {
         // Defence succeeded - apply race-specific damage
-        damage = defender->processSuccessfulDefence(
-            calculateDamage(attacker->getAttack(), defender->getDefence()),
-            attacker->getAttack(),
-            isDaytime
+        damage = defender.processSuccessfulDefence(
+            calculateDamage(attacker.getAttack(), defender.getDefence()),
+            attacker.getAttack(),
+            isDaytime,
+            roll.effect
             );
 
         if (damage < 0) {
             // Negative damage means health increase (Elf/Orc night ability)
             // Note: This would require modifying the character interface
             // For now, we'll handle this specially in the game logic
-            defender->takeDamage(damage); // Negative damage increases health
+            defender.takeDamage(damage); // Negative damage increases health
         } else {
-            defender->takeDamage(damage);
+            defender.takeDamage(damage);
         }
     }
 
     // Step 3: Check if defender is defeated
-    if (defender->isDefeated()) {
+    if (defender.isDefeated()) {
         // Award gold equal to defender's defence value including items
-        goldEarned = defender->getGoldValue();
+        goldEarned = defender.getGoldValue();
     }
 
     return std::make_pair(true, goldEarned);
 }
 
-bool Combat::checkSuccess(double probability) {
-    // Generate random number between 0.0 and 1.0
-    std::uniform_real_distribution<> dis(0.0, 1.0);
-    double randomValue = dis(gen);
+Combat::RoundFunction Combat::getRoundFunction(Race attacker, Race defender) {
+    return ROUND_TABLE[pairIndex(attacker, defender)];
+}
 
-    // Check if random value is within success probability
-    return randomValue <= probability;
+void Combat::executeRoundSequence(Character& attacker, Character& defender, bool isDaytime,
+                                  const CombatRoll* rolls, std::size_t count, RoundResult* results) {
+    SEQUENCE_TABLE[pairIndex(attacker.getRaceId(), defender.getRaceId())](
+        attacker, defender, isDaytime, rolls, count, results);
+}
+
+void Combat::executeRounds(const CombatPair* fights, std::size_t count, bool isDaytime, RoundResult* results) {
+    for (std::size_t i = 0; i < count; ++i) {
+        results[i] = executeCombatRound(*fights[i].first, *fights[i].second, isDaytime);
+    }
+}
+
+std::vector<Combat::RoundResult> Combat::executeRounds(const std::vector<CombatPair>& fights, bool isDaytime) {
+    std::vector<RoundResult> results(fights.size());
+    executeRounds(fights.data(), fights.size(), isDaytime, results.data());
+    return results;
+}
+
+bool Combat::checkSuccess(double probability) {
+    // Check if a random value between 0.0 and 1.0 is within success probability
+    return rng.chance(probability);
 }
 
 int Combat::calculateDamage(int attackerAttack, int defenderDefence) {
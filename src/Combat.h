@@ -7,8 +7,24 @@
 #define COMBAT_H
 
 #include <memory>
+#include <cstddef>
+#include <utility>
+#include <vector>
 #include "Character.h"
-#include <random>
+#include "Rng.h"
+
+/**
+ * @struct CombatRoll
+ * @brief The three uniform random values one combat round consumes
+ *
+ * Supplying the rolls explicitly lets batch and simulation code reproduce
+ * the exact outcome of a scalar round from the same random stream.
+ */
+struct CombatRoll {
+    double attack;  ///< Compared against the attacker's attack chance
+    double defence; ///< Compared against the defender's defence chance
+    double effect;  ///< Passed to processSuccessfulDefence for random race effects
+};
 
 /**
  * @class Combat
@@ -19,21 +35,42 @@
  */
 class Combat {
 private:
-    std::random_device rd;
-    std::mt19937 gen;
+    Rng rng;
 
 public:
     /**
-     * @brief Constructor for Combat system
+     * @brief Constructor for Combat system with a non-reproducible random stream
      */
     Combat();
 
+    /**
+     * @brief Constructor for Combat system
+     * @param generator Random stream this combat system draws its rolls from
+     */
+    explicit Combat(Rng generator);
+
+    /**
+     * @brief Get the random stream used for combat rolls
+     * @return Rng& Generator owned by this combat system
+     */
+    Rng& getRng();
+
+    /**
+     * @brief Attacker/defender pair for batched combat rounds
+     */
+    using CombatPair = std::pair<Character*, Character*>;
+
+    /**
+     * @brief Outcome of one combat round (attack landed, gold earned if defender defeated)
+     */
+    using RoundResult = std::pair<bool, int>;
+
     /**
      * @brief Execute a combat round between attacker and defender
      * @param attacker The character initiating the attack
      * @param defender The character being attacked
      * @param isDaytime Current time of day for race abilities
-     * @return std::pair<bool, int> (combat completed, gold earned if enemy defeated)
+     * @return RoundResult (combat completed, gold earned if enemy defeated)
      *
      * Pseudo-code:
      * 1. Check if attacker's attack succeeds based on attack chance
@@ -43,9 +80,69 @@ public:
      * 5. Check if defender is defeated and award gold
      * 6. Return combat result
      */
-    std::pair<bool, int> executeCombatRound(std::shared_ptr<Character> attacker,
-                                            std::shared_ptr<Character> defender,
-                                            bool isDaytime);
+    RoundResult executeCombatRound(Character& attacker, Character& defender, bool isDaytime);
+
+    /**
+     * @brief Execute a combat round with caller-supplied random values
+     * @param attacker The character initiating the attack
+     * @param defender The character being attacked
+     * @param isDaytime Current time of day for race abilities
+     * @param roll Uniform values in [0, 1) deciding the round
+     * @return RoundResult (combat completed, gold earned if enemy defeated)
+     */
+    static RoundResult executeCombatRound(Character& attacker, Character& defender, bool isDaytime,
+                                          const CombatRoll& roll);
+
+    /**
+     * @brief Combat round specialized for one attacker/defender race pair
+     */
+    using RoundFunction = RoundResult (*)(Character& attacker, Character& defender, bool isDaytime,
+                                          const CombatRoll& roll);
+
+    /**
+     * @brief Look up the specialized round for a race pair
+     * @param attacker Attacker race
+     * @param defender Defender race
+     * @return RoundFunction Entry of the 25-way jump table
+     *
+     * The function needs no virtual calls. It gives the same results as
+     * executeCombatRound() with a roll, for characters of those races.
+     * Look it up once per pair and call it in the inner loop.
+     */
+    static RoundFunction getRoundFunction(Race attacker, Race defender);
+
+    /**
+     * @brief Execute rounds between one attacker and defender with a single dispatch
+     * @param attacker The character initiating each attack
+     * @param defender The character being attacked
+     * @param isDaytime Current time of day for race abilities
+     * @param rolls One roll per round
+     * @param count Number of rounds
+     * @param results Output array receiving one RoundResult per round
+     */
+    static void executeRoundSequence(Character& attacker, Character& defender, bool isDaytime,
+                                     const CombatRoll* rolls, std::size_t count, RoundResult* results);
+
+    /**
+     * @brief Execute one combat round for each attacker/defender pair
+     * @param fights Array of pairs (neither pointer may be null)
+     * @param count Number of pairs
+     * @param isDaytime Current time of day for race abilities
+     * @param results Output array receiving one RoundResult per pair
+     *
+     * Rounds are resolved in order with the same random draws as calling
+     * executeCombatRound() once per pair, so a character may appear in
+     * several pairs and sees the effects of earlier ones.
+     */
+    void executeRounds(const CombatPair* fights, std::size_t count, bool isDaytime, RoundResult* results);
+
+    /**
+     * @brief Execute one combat round for each attacker/defender pair
+     * @param fights Pairs to resolve (neither pointer may be null)
+     * @param isDaytime Current time of day for race abilities
+     * @return std::vector<RoundResult> One result per pair
+     */
+    std::vector<RoundResult> executeRounds(const std::vector<CombatPair>& fights, bool isDaytime);
 
     /**
      * @brief Check if a probability-based action succeeds
@@ -60,7 +157,7 @@ public:
      * @param defenderDefence Defender's total defence value
      * @return int Damage to apply to defender
      */
-    int calculateDamage(int attackerAttack, int defenderDefence);
+    static int calculateDamage(int attackerAttack, int defenderDefence);
 };
 
 #endif // COMBAT_H
@@ -0,0 +1,130 @@
+/**
+ * @file CombatBatch.cpp
+ * @brief Implementation of CombatBatch class
+ */
+
+#include "CombatBatch.h"
+#include "CombatSimulator.h"
+#include "RaceTraits.h"
+
+std::uint32_t CombatBatch::add(const Character& character) {
+    const std::uint32_t index = static_cast<std::uint32_t>(attack.size());
+
+    attack.push_back(character.getAttack());
+    defence.push_back(character.getDefence());
+    health.push_back(CombatSimulator::baseHealth(character));
+    goldValue.push_back(character.getGoldValue());
+
+    for (int time = 0; time < 2; ++time) {
+        const bool isDaytime = time == 1;
+        const DefenceRule& rule = raceTraits(character.getRaceId()).defenceRule[isDaytime];
+        attackChance[time].push_back(character.getAttackChance(isDaytime));
+        defenceChance[time].push_back(character.getDefenceChance(isDaytime));
+        blockFixed[time].push_back(rule.fixed);
+        blockSpan[time].push_back(rule.span);
+        blockQuarter[time].push_back(rule.quarter);
+    }
+    return index;
+}
+
+void CombatBatch::clear() {
+    attack.clear();
+    defence.clear();
+    health.clear();
+    goldValue.clear();
+    for (int time = 0; time < 2; ++time) {
+        attackChance[time].clear();
+        defenceChance[time].clear();
+        blockFixed[time].clear();
+        blockSpan[time].clear();
+        blockQuarter[time].clear();
+    }
+}
+
+std::size_t CombatBatch::size() const {
+    return attack.size();
+}
+
+int CombatBatch::getHealth(std::uint32_t index) const {
+    return health[index];
+}
+
+bool CombatBatch::isDefeated(std::uint32_t index) const {
+    return health[index] <= 0;
+}
+
+void CombatBatch::resolveRound(const std::uint32_t* attackers, const std::uint32_t* defenders, std::size_t count,
+                               bool isDaytime, const CounterRng& rng, std::uint64_t round,
+                               RoundResults& results) {
+    const int time = isDaytime ? 1 : 0;
+
+    pairAttack.resize(count);
+    pairDefence.resize(count);
+    pairAttackChance.resize(count);
+    pairDefenceChance.resize(count);
+    pairBlockFixed.resize(count);
+    pairBlockSpan.resize(count);
+    pairBlockQuarter.resize(count);
+    rollAttack.resize(count);
+    rollDefence.resize(count);
+    rollEffect.resize(count);
+    results.landed.resize(count);
+    results.damage.resize(count);
+    results.gold.resize(count);
+
+    // Pass 1: gather pair stats into contiguous lanes
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t a = attackers[i];
+        const std::uint32_t d = defenders[i];
+        pairAttack[i] = attack[a];
+        pairDefence[i] = defence[d];
+        pairAttackChance[i] = attackChance[time][a];
+        pairDefenceChance[i] = defenceChance[time][d];
+        pairBlockFixed[i] = blockFixed[time][d];
+        pairBlockSpan[i] = blockSpan[time][d];
+        pairBlockQuarter[i] = blockQuarter[time][d];
+    }
+
+    // Counter-based rolls: each lane is independent, so this loop vectorizes too
+    for (std::size_t i = 0; i < count; ++i) {
+        const CounterRng::Block block = rng(round, i);
+        rollAttack[i] = CounterRng::toUnit(block[0]);
+        rollDefence[i] = CounterRng::toUnit(block[1]);
+        rollEffect[i] = CounterRng::toUnit(block[2]);
+    }
+
+    // Pass 2: branch-free damage kernel
+    const int* atk = pairAttack.data();
+    const int* def = pairDefence.data();
+    const double* hitChance = pairAttackChance.data();
+    const double* blockChance = pairDefenceChance.data();
+    const int* fixed = pairBlockFixed.data();
+    const int* span = pairBlockSpan.data();
+    const int* quarter = pairBlockQuarter.data();
+    const double* hitRoll = rollAttack.data();
+    const double* blockRoll = rollDefence.data();
+    const double* effectRoll = rollEffect.data();
+    std::uint8_t* landed = results.landed.data();
+    int* damage = results.damage.data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const int difference = atk[i] - def[i];
+        const int fullDamage = difference > 0 ? difference : 0; // Combat::calculateDamage
+        const int quarterDamage = difference / 4 > 0 ? difference / 4 : 0;
+        const int blockDamage = fixed[i] + static_cast<int>(effectRoll[i] * span[i]) + quarter[i] * quarterDamage;
+        const bool hit = hitRoll[i] <= hitChance[i];
+        const int dealt = blockRoll[i] <= blockChance[i] ? blockDamage : fullDamage;
+
+        landed[i] = hit ? 1 : 0;
+        damage[i] = hit ? dealt : 0;
+    }
+
+    // Pass 3: apply in pair order, as sequential scalar rounds would
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t d = defenders[i];
+        int remaining = health[d] - damage[i];
+        if (remaining < 0) remaining = 0;
+        health[d] = remaining;
+        results.gold[i] = (landed[i] && remaining <= 0) ? goldValue[d] : 0;
+    }
+}
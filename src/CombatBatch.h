@@ -0,0 +1,130 @@
+/**
+ * @file CombatBatch.h
+ * @brief Structure-of-arrays character storage with a vectorizable combat kernel
+ */
+
+#ifndef COMBATBATCH_H
+#define COMBATBATCH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Character.h"
+#include "Combat.h"
+#include "CounterRng.h"
+
+/**
+ * @class CombatBatch
+ * @brief Resolves one combat round for many attacker/defender pairs at once
+ *
+ * Characters are snapshotted into parallel arrays (attack, defence,
+ * health, chances and defence rule per time of day). A round runs in
+ * three passes:
+ * 1. Gather each pair's stats into contiguous scratch arrays and draw its
+ *    rolls from the counter-based generator.
+ * 2. A branch-free loop computes every pair's damage with compares and
+ *    selects only, so the compiler can vectorize it.
+ * 3. Damage is applied to health in pair order, so a character in several
+ *    pairs behaves as if the rounds ran one after another.
+ *
+ * Pair i of round r uses CombatBatch::rollFor(rng, r, i). Passing the same
+ * roll to the scalar Combat::executeCombatRound() gives identical results.
+ */
+class CombatBatch {
+public:
+    /**
+     * @struct RoundResults
+     * @brief Per-pair outcome of one batched round
+     */
+    struct RoundResults {
+        std::vector<std::uint8_t> landed; ///< 1 if the attack hit
+        std::vector<int> damage;          ///< Damage dealt (negative heals, 0 on a miss)
+        std::vector<int> gold;            ///< Gold earned if the defender was defeated
+    };
+
+    /**
+     * @brief Add a snapshot of a character to the batch
+     * @param character Character to copy stats from
+     * @return std::uint32_t Index of the character in the batch
+     */
+    std::uint32_t add(const Character& character);
+
+    /**
+     * @brief Remove all characters
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of characters in the batch
+     * @return std::size_t Character count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Get a character's current health (as Character::isDefeated() sees it)
+     * @param index Character index
+     * @return int Health without item modifiers
+     */
+    int getHealth(std::uint32_t index) const;
+
+    /**
+     * @brief Check whether a character has been defeated
+     * @param index Character index
+     * @return bool True if health <= 0
+     */
+    bool isDefeated(std::uint32_t index) const;
+
+    /**
+     * @brief The rolls pair @p pair uses in round @p round
+     * @param rng Counter-based generator
+     * @param round Round number
+     * @param pair Pair index within the round
+     * @return CombatRoll Attack, defence and effect rolls
+     */
+    static CombatRoll rollFor(const CounterRng& rng, std::uint64_t round, std::uint64_t pair) {
+        const CounterRng::Block block = rng(round, pair);
+        return CombatRoll{CounterRng::toUnit(block[0]), CounterRng::toUnit(block[1]),
+                          CounterRng::toUnit(block[2])};
+    }
+
+    /**
+     * @brief Resolve one combat round for each attacker/defender pair
+     * @param attackers Attacker index per pair
+     * @param defenders Defender index per pair
+     * @param count Number of pairs
+     * @param isDaytime Current time of day for race abilities
+     * @param rng Counter-based generator supplying the rolls
+     * @param round Round number (selects the random stream)
+     * @param results Output, resized to count
+     */
+    void resolveRound(const std::uint32_t* attackers, const std::uint32_t* defenders, std::size_t count,
+                      bool isDaytime, const CounterRng& rng, std::uint64_t round, RoundResults& results);
+
+private:
+    // Character snapshots; per-time arrays are indexed [isDaytime]
+    std::vector<int> attack;
+    std::vector<int> defence;
+    std::vector<int> health;
+    std::vector<int> goldValue;
+    std::vector<double> attackChance[2];
+    std::vector<double> defenceChance[2];
+
+    // Successful defence damage per lane, from the defender's DefenceRule
+    std::vector<int> blockFixed[2];
+    std::vector<int> blockSpan[2];
+    std::vector<int> blockQuarter[2];
+
+    // Per-pair scratch reused between rounds
+    std::vector<int> pairAttack;
+    std::vector<int> pairDefence;
+    std::vector<double> pairAttackChance;
+    std::vector<double> pairDefenceChance;
+    std::vector<int> pairBlockFixed;
+    std::vector<int> pairBlockSpan;
+    std::vector<int> pairBlockQuarter;
+    std::vector<double> rollAttack;
+    std::vector<double> rollDefence;
+    std::vector<double> rollEffect;
+};
+
+#endif // COMBATBATCH_H
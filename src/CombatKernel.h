@@ -0,0 +1,88 @@
+/**
+ * @file CombatKernel.h
+ * @brief Combat rounds specialized at compile time for one attacker/defender race pair
+ */
+
+#ifndef COMBATKERNEL_H
+#define COMBATKERNEL_H
+
+#include <cstddef>
+#include "Combat.h"
+#include "RaceTraits.h"
+
+/**
+ * @class CombatKernel
+ * @brief Combat::executeCombatRound() with both races known at compile time
+ *
+ * Chances, defence rules and whether items count are constants from
+ * RACE_TRAITS, so the round compiles to straight-line arithmetic. Health
+ * and inventory are reached through non-virtual calls only. Results are
+ * identical to the dynamic path for the same CombatRoll.
+ *
+ * Use Combat::getRoundFunction() or Combat::executeRoundSequence() to
+ * select the specialization from runtime races.
+ */
+template <Race AttackerRace, Race DefenderRace>
+class CombatKernel {
+public:
+    /**
+     * @brief Execute one combat round
+     * @param attacker Character of race AttackerRace
+     * @param defender Character of race DefenderRace
+     * @param isDaytime Current time of day
+     * @param roll Uniform values in [0, 1) deciding the round
+     * @return Combat::RoundResult (attack landed, gold earned if defender defeated)
+     */
+    static Combat::RoundResult executeRound(Character& attacker, Character& defender, bool isDaytime,
+                                            const CombatRoll& roll) {
+        constexpr const RaceTraits& attackerTraits = raceTraits(AttackerRace);
+        constexpr const RaceTraits& defenderTraits = raceTraits(DefenderRace);
+
+        if (!(roll.attack <= attackerTraits.attackChance[isDaytime])) {
+            return Combat::RoundResult(false, 0);
+        }
+
+        const int attack = statWithItems<AttackerRace>(
+            attackerTraits.attack, static_cast<const Character&>(attacker).getInventory().getTotalModifications().attack);
+        const int defence = statWithItems<DefenderRace>(
+            defenderTraits.defence, static_cast<const Character&>(defender).getInventory().getTotalModifications().defence);
+
+        // Combat::calculateDamage for integer stats
+        int damage = attack - defence > 0 ? attack - defence : 0;
+        if (roll.defence <= defenderTraits.defenceChance[isDaytime]) {
+            damage = defenderTraits.defenceRule[isDaytime].apply(attack, defence, roll.effect);
+        }
+
+        // Qualified calls skip virtual dispatch; no race overrides these
+        defender.Character::takeDamage(damage);
+        const int gold = defender.Character::isDefeated() ? defence : 0; // Gold is the defender's defence
+        return Combat::RoundResult(true, gold);
+    }
+
+    /**
+     * @brief Execute a sequence of rounds with the same attacker and defender
+     * @param attacker Character of race AttackerRace
+     * @param defender Character of race DefenderRace
+     * @param isDaytime Current time of day
+     * @param rolls One roll per round
+     * @param count Number of rounds
+     * @param results Output, one result per round
+     */
+    static void executeSequence(Character& attacker, Character& defender, bool isDaytime,
+                                const CombatRoll* rolls, std::size_t count, Combat::RoundResult* results) {
+        for (std::size_t i = 0; i < count; ++i) {
+            results[i] = executeRound(attacker, defender, isDaytime, rolls[i]);
+        }
+    }
+
+private:
+    /**
+     * @brief Add an item modifier if the race's combat stats use items
+     */
+    template <Race R>
+    static constexpr int statWithItems(int base, int itemModifier) {
+        return raceTraits(R).itemsAffectCombat ? base + itemModifier : base;
+    }
+};
+
+#endif // COMBATKERNEL_H
@@ -0,0 +1,241 @@
+/**
+ * @file CombatSimulator.cpp
+ * @brief Implementation of CombatSimulator class
+ */
+
+#include "CombatSimulator.h"
+#include "Board.h"
+#include "Combat.h"
+#include "CounterRng.h"
+#include "RaceTraits.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+/**
+ * @class DuelStream
+ * @brief Sequential view of one duel's counter-based random stream
+ */
+class DuelStream {
+private:
+    const CounterRng& rng;
+    std::uint64_t duel;
+    std::uint64_t block;
+    CounterRng::Block words;
+    int used;
+
+public:
+    DuelStream(const CounterRng& generator, std::uint64_t duelIndex)
+        : rng(generator), duel(duelIndex), block(0), words{}, used(4) {}
+
+    std::uint32_t next() {
+        if (used == 4) {
+            words = rng(duel, block++);
+            used = 0;
+        }
+        return words[used++];
+    }
+};
+
+/**
+ * @brief Create a character of the loadout's race carrying its items
+ * @param loadout Race and items
+ * @return std::unique_ptr<Character> Equipped character
+ */
+std::unique_ptr<Character> equip(const CombatLoadout& loadout) {
+    std::unique_ptr<Character> character = Board::createEnemy(loadout.race);
+    for (ItemId item : loadout.items) {
+        character->getInventory().addItem(item);
+    }
+    return character;
+}
+
+/**
+ * @brief Resolve one Combat::executeCombatRound on precomputed numbers
+ * @param exchange Outcome table for this attacker/defender direction
+ * @param defenderHealth Defender health, updated in place
+ * @param random Duel random stream
+ * @return bool True if the attack hit
+ */
+inline bool strike(const CombatSimulator::Exchange& exchange, int& defenderHealth, DuelStream& random) {
+    if (CounterRng::toUnit(random.next()) > exchange.hitChance) {
+        return false; // Attack failed
+    }
+
+    int damage = exchange.hitDamage;
+    if (CounterRng::toUnit(random.next()) <= exchange.blockChance) {
+        damage = exchange.blockDamage;
+        if (exchange.blockSpread > 0) {
+            damage += static_cast<int>(CounterRng::bounded(random.next(), exchange.blockSpread + 1));
+        }
+    }
+
+    // Same as Character::takeDamage: negative damage heals, health floors at zero
+    defenderHealth -= damage;
+    if (defenderHealth < 0) defenderHealth = 0;
+    return true;
+}
+
+} // namespace
+
+std::string CombatLoadout::describe() const {
+    std::string text = raceTraits(race).name;
+    for (ItemId item : items) {
+        text += "+" + std::string(ItemCatalog::getEntry(item).name);
+    }
+    return text;
+}
+
+double CombatSimulator::Result::winRate() const {
+    return duels ? static_cast<double>(playerWins) / duels : 0.0;
+}
+
+double CombatSimulator::Result::meanRoundsToKill() const {
+    std::uint64_t decided = playerWins + enemyWins;
+    return decided ? static_cast<double>(decidedRounds) / decided : 0.0;
+}
+
+double CombatSimulator::Result::meanGold() const {
+    double total = 0.0;
+    for (const auto& bucket : goldHistogram) {
+        total += static_cast<double>(bucket.first) * bucket.second;
+    }
+    return duels ? total / duels : 0.0;
+}
+
+void CombatSimulator::Result::merge(const Result& other) {
+    duels += other.duels;
+    playerWins += other.playerWins;
+    enemyWins += other.enemyWins;
+    draws += other.draws;
+    totalRounds += other.totalRounds;
+    decidedRounds += other.decidedRounds;
+    for (const auto& bucket : other.goldHistogram) {
+        goldHistogram[bucket.first] += bucket.second;
+    }
+}
+
+CombatSimulator::CombatSimulator(std::uint64_t seed, unsigned int threads)
+    : seed(seed), threads(threads ? threads : std::max(1u, std::thread::hardware_concurrency())) {
+    // Worker count fixed for the simulator's lifetime
+}
+
+CombatSimulator::Matchup CombatSimulator::buildMatchup(const CombatLoadout& player,
+                                                       const CombatLoadout& enemy,
+                                                       bool isDaytime) {
+    return buildMatchup(*equip(player), *equip(enemy), isDaytime);
+}
+
+CombatSimulator::Matchup CombatSimulator::buildMatchup(const Character& player, const Character& enemy,
+                                                       bool isDaytime) {
+    Matchup matchup;
+    matchup.playerHealth = baseHealth(player);
+    matchup.enemyHealth = baseHealth(enemy);
+    matchup.enemyGold = enemy.getGoldValue();
+    matchup.playerAttack = buildExchange(player, enemy, isDaytime);
+    matchup.enemyAttack = buildExchange(enemy, player, isDaytime);
+    return matchup;
+}
+
+CombatSimulator::Exchange CombatSimulator::buildExchange(const Character& attacker, const Character& defender,
+                                                         bool isDaytime) {
+    const int damage = Combat::calculateDamage(attacker.getAttack(), defender.getDefence());
+
+    Exchange exchange;
+    exchange.hitChance = attacker.getAttackChance(isDaytime);
+    exchange.blockChance = defender.getDefenceChance(isDaytime);
+    exchange.hitDamage = damage;
+
+    // A defence rule's random part takes span equally likely values 0..span-1,
+    // so the lowest roll gives the fixed damage and the rest is the spread
+    const DefenceRule& rule = raceTraits(defender.getRaceId()).defenceRule[isDaytime];
+    exchange.blockDamage = rule.apply(attacker.getAttack(), defender.getDefence(), 0.0);
+    exchange.blockSpread = rule.span > 0 ? rule.span - 1 : 0;
+    return exchange;
+}
+
+int CombatSimulator::baseHealth(const Character& character) {
+    // Defeat is checked on base health; item health modifiers only change getHealth()
+    return character.getHealth() - character.getInventory().getTotalModifications().health;
+}
+
+CombatSimulator::Result CombatSimulator::run(const CombatLoadout& player, const CombatLoadout& enemy,
+                                             bool isDaytime, std::uint64_t duels) const {
+    return run(buildMatchup(player, enemy, isDaytime), duels);
+}
+
+CombatSimulator::Result CombatSimulator::run(const Matchup& matchup, std::uint64_t duels) const {
+    const std::uint64_t workerCount = std::max<std::uint64_t>(1, std::min<std::uint64_t>(threads, duels));
+    const std::uint64_t perWorker = (duels + workerCount - 1) / workerCount;
+
+    std::vector<Result> partial(workerCount);
+    std::vector<std::thread> workers;
+    for (std::uint64_t w = 1; w < workerCount; ++w) {
+        std::uint64_t first = std::min(duels, w * perWorker);
+        std::uint64_t count = std::min(duels, first + perWorker) - first;
+        workers.emplace_back([this, &matchup, &partial, w, first, count]() {
+            partial[w] = runRange(matchup, first, count);
+        });
+    }
+    partial[0] = runRange(matchup, 0, std::min(duels, perWorker));
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Result total;
+    for (const Result& part : partial) {
+        total.merge(part);
+    }
+    return total;
+}
+
+CombatSimulator::Result CombatSimulator::runRange(const Matchup& matchup, std::uint64_t firstDuel,
+                                                  std::uint64_t count) const {
+    const CounterRng rng(seed);
+    Result result;
+    std::uint64_t goldWins = 0;
+
+    for (std::uint64_t duel = firstDuel; duel < firstDuel + count; ++duel) {
+        DuelStream random(rng, duel);
+        int playerHealth = matchup.playerHealth;
+        int enemyHealth = matchup.enemyHealth;
+        int rounds = 0;
+        int outcome = 0; // 1 = player won, -1 = enemy won, 0 = draw
+
+        while (rounds < MAX_ROUNDS) {
+            // Player attacks first; a defeated enemy cannot counterattack
+            strike(matchup.playerAttack, enemyHealth, random);
+            ++rounds;
+            if (enemyHealth <= 0) {
+                outcome = 1;
+                break;
+            }
+
+            strike(matchup.enemyAttack, playerHealth, random);
+            ++rounds;
+            if (playerHealth <= 0) {
+                outcome = -1;
+                break;
+            }
+        }
+
+        result.totalRounds += rounds;
+        if (outcome == 1) {
+            ++result.playerWins;
+            ++goldWins;
+            result.decidedRounds += rounds;
+        } else if (outcome == -1) {
+            ++result.enemyWins;
+            result.decidedRounds += rounds;
+        } else {
+            ++result.draws;
+        }
+    }
+
+    result.duels = count;
+    if (goldWins) result.goldHistogram[matchup.enemyGold] += goldWins;
+    if (count > goldWins) result.goldHistogram[0] += count - goldWins;
+    return result;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file CombatSimulator.h
+ * @brief Headless Monte-Carlo duel simulator for balance analysis
+ */
+
+#ifndef COMBATSIMULATOR_H
+#define COMBATSIMULATOR_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "Character.h"
+#include "ItemCatalog.h"
+
+/**
+ * @struct CombatLoadout
+ * @brief A race plus the items it carries into a duel
+ */
+struct CombatLoadout {
+    Race race;
+    std::vector<ItemId> items; ///< Items to equip; ones the inventory rejects are skipped
+
+    /**
+     * @brief Describe the loadout for reports, e.g. "Elf+Sword+Small Shield"
+     * @return std::string Readable summary
+     */
+    std::string describe() const;
+};
+
+/**
+ * @class CombatSimulator
+ * @brief Runs many player-versus-enemy duels in parallel and aggregates outcomes
+ *
+ * A duel follows Game::handleAttack: the player attacks, then the enemy
+ * counterattacks unless it was defeated, until one side falls. Each
+ * attack follows Combat::executeCombatRound.
+ *
+ * Before simulating, both fighters are built as real Character objects
+ * with their items, and their stats, chances and defence outcomes are
+ * read from them. Stat changes in the race classes therefore show up
+ * here. The inner loop then works on those precomputed numbers.
+ *
+ * Every duel draws from its own counter-based random stream (seed, duel
+ * index), so results are identical for any thread count.
+ */
+class CombatSimulator {
+public:
+    /**
+     * @brief Duels still undecided after this many combat rounds count as draws
+     */
+    static constexpr int MAX_ROUNDS = 10000;
+
+    /**
+     * @struct Exchange
+     * @brief Outcome table for one side attacking the other
+     */
+    struct Exchange {
+        double hitChance;    ///< Attacker's attack chance
+        double blockChance;  ///< Defender's defence chance
+        int hitDamage;       ///< Damage when the defence fails
+        int blockDamage;     ///< Damage when the defence succeeds (negative heals)
+        int blockSpread;     ///< If > 0, a uniform 0..blockSpread is added to blockDamage
+    };
+
+    /**
+     * @struct Matchup
+     * @brief Everything the duel loop needs about a player/enemy pair
+     */
+    struct Matchup {
+        int playerHealth;      ///< Player starting health (the value defeat is checked on)
+        int enemyHealth;       ///< Enemy starting health
+        int enemyGold;         ///< Gold the player earns for a win
+        Exchange playerAttack; ///< Player attacking the enemy
+        Exchange enemyAttack;  ///< Enemy counterattacking the player
+    };
+
+    /**
+     * @struct Result
+     * @brief Aggregated outcome of a batch of duels
+     */
+    struct Result {
+        std::uint64_t duels = 0;
+        std::uint64_t playerWins = 0;
+        std::uint64_t enemyWins = 0;
+        std::uint64_t draws = 0;
+        std::uint64_t totalRounds = 0;    ///< Combat rounds simulated in all duels
+        std::uint64_t decidedRounds = 0;  ///< Combat rounds in duels that ended in a defeat
+        std::map<int, std::uint64_t> goldHistogram; ///< Gold earned per duel -> duel count
+
+        /**
+         * @brief Fraction of duels the player won
+         * @return double Win rate (0.0 to 1.0)
+         */
+        double winRate() const;
+
+        /**
+         * @brief Mean combat rounds until one side was defeated
+         * @return double Rounds per decided duel
+         */
+        double meanRoundsToKill() const;
+
+        /**
+         * @brief Mean gold earned per duel
+         * @return double Gold per duel
+         */
+        double meanGold() const;
+
+        /**
+         * @brief Add another batch's counts to this one
+         * @param other Result to merge in
+         */
+        void merge(const Result& other);
+    };
+
+    /**
+     * @brief Constructor for CombatSimulator
+     * @param seed Seed for the duel random streams
+     * @param threads Worker threads (0 = all hardware threads)
+     */
+    explicit CombatSimulator(std::uint64_t seed, unsigned int threads = 0);
+
+    /**
+     * @brief Build the duel tables for a player/enemy pair
+     * @param player Player loadout
+     * @param enemy Enemy loadout
+     * @param isDaytime Time of day for race abilities
+     * @return Matchup Precomputed stats and outcome tables
+     */
+    static Matchup buildMatchup(const CombatLoadout& player, const CombatLoadout& enemy, bool isDaytime);
+
+    /**
+     * @brief Build the duel tables for two existing characters at their current health
+     * @param player Player character
+     * @param enemy Enemy character
+     * @param isDaytime Time of day for race abilities
+     * @return Matchup Precomputed stats and outcome tables
+     */
+    static Matchup buildMatchup(const Character& player, const Character& enemy, bool isDaytime);
+
+    /**
+     * @brief Build the outcome table for one character attacking another
+     * @param attacker Attacking character (with items equipped)
+     * @param defender Defending character (with items equipped)
+     * @param isDaytime Time of day for race abilities
+     * @return Exchange Chances and damage values
+     */
+    static Exchange buildExchange(const Character& attacker, const Character& defender, bool isDaytime);
+
+    /**
+     * @brief Get a character's health as Character::isDefeated() sees it
+     * @param character Character to inspect
+     * @return int Health without item modifiers
+     */
+    static int baseHealth(const Character& character);
+
+    /**
+     * @brief Simulate a batch of duels between two loadouts
+     * @param player Player loadout
+     * @param enemy Enemy loadout
+     * @param isDaytime Time of day (fixed for the whole duel, as in the game)
+     * @param duels Number of duels to run
+     * @return Result Aggregated outcome
+     */
+    Result run(const CombatLoadout& player, const CombatLoadout& enemy, bool isDaytime,
+               std::uint64_t duels) const;
+
+    /**
+     * @brief Simulate a batch of duels for a prepared matchup
+     * @param matchup Matchup from buildMatchup()
+     * @param duels Number of duels to run
+     * @return Result Aggregated outcome
+     */
+    Result run(const Matchup& matchup, std::uint64_t duels) const;
+
+private:
+    std::uint64_t seed;
+    unsigned int threads;
+
+    /**
+     * @brief Simulate a contiguous range of duels on the calling thread
+     * @param matchup Matchup to simulate
+     * @param firstDuel Index of the first duel (selects its random stream)
+     * @param count Number of duels
+     * @return Result Outcome of the range
+     */
+    Result runRange(const Matchup& matchup, std::uint64_t firstDuel, std::uint64_t count) const;
+};
+
+#endif // COMBATSIMULATOR_H
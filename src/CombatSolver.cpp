@@ -0,0 +1,255 @@
+/**
+ * @file CombatSolver.cpp
+ * @brief Implementation of CombatSolver class
+ */
+
+#include "CombatSolver.h"
+#include "Board.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+namespace {
+
+using DamageDistribution = std::vector<std::pair<int, double>>;
+
+/**
+ * @brief Sweeps of the value iteration before giving up on convergence
+ */
+constexpr int MAX_SWEEPS = 20000;
+
+/**
+ * @brief Largest per-state change accepted as converged
+ */
+constexpr double TOLERANCE = 1e-13;
+
+/**
+ * @brief Turn an exchange into the probability of each damage value
+ * @param exchange Outcome table for one attack
+ * @return DamageDistribution (damage, probability) pairs, including misses as 0
+ */
+DamageDistribution damageDistribution(const CombatSimulator::Exchange& exchange) {
+    const double hit = std::clamp(exchange.hitChance, 0.0, 1.0);
+    const double block = std::clamp(exchange.blockChance, 0.0, 1.0);
+
+    std::map<int, double> merged;
+    merged[0] += 1.0 - hit;
+    merged[exchange.hitDamage] += hit * (1.0 - block);
+    const double spreadShare = hit * block / (exchange.blockSpread + 1);
+    for (int extra = 0; extra <= exchange.blockSpread; ++extra) {
+        merged[exchange.blockDamage + extra] += spreadShare;
+    }
+
+    DamageDistribution distribution;
+    for (const auto& entry : merged) {
+        if (entry.second > 0.0) distribution.push_back(entry);
+    }
+    return distribution;
+}
+
+/**
+ * @brief Apply damage the way Character::takeDamage does, within the tracked range
+ * @param health Current health
+ * @param damage Damage (negative heals)
+ * @param maxHealth Highest tracked health; heals beyond it are dropped
+ * @return int New health
+ */
+inline int applyDamage(int health, int damage, int maxHealth) {
+    return std::clamp(health - damage, 0, maxHealth);
+}
+
+/**
+ * @brief Mix one field into an FNV-1a hash
+ */
+inline std::size_t mixHash(std::size_t hash, std::uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        hash ^= static_cast<std::size_t>((value >> (i * 8)) & 0xFF);
+        hash *= static_cast<std::size_t>(1099511628211ULL);
+    }
+    return hash;
+}
+
+} // namespace
+
+bool CombatSolver::Key::operator==(const Key& other) const {
+    return playerRace == other.playerRace && enemyRace == other.enemyRace &&
+           isDaytime == other.isDaytime && playerStats == other.playerStats &&
+           enemyStats == other.enemyStats;
+}
+
+std::size_t CombatSolver::KeyHash::operator()(const Key& key) const {
+    std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+    hash = mixHash(hash, static_cast<std::uint64_t>(key.playerRace));
+    hash = mixHash(hash, static_cast<std::uint64_t>(key.enemyRace));
+    hash = mixHash(hash, key.isDaytime);
+    for (int stat : key.playerStats) hash = mixHash(hash, static_cast<std::uint32_t>(stat));
+    for (int stat : key.enemyStats) hash = mixHash(hash, static_cast<std::uint32_t>(stat));
+    return hash;
+}
+
+CombatSolver::Outcome CombatSolver::Table::at(int playerHealth, int enemyHealth) const {
+    const std::size_t index = static_cast<std::size_t>(playerHealth) * (maxEnemyHealth + 1) + enemyHealth;
+
+    Outcome outcome;
+    outcome.winProbability = win[index];
+    outcome.lossProbability = loss[index];
+    outcome.drawProbability = std::max(0.0, 1.0 - win[index] - loss[index]);
+    outcome.expectedGold = win[index] * matchup.enemyGold;
+    outcome.expectedDamageTaken = playerHealth - finalHealth[index];
+    return outcome;
+}
+
+CombatSolver::CombatSolver(int healthHeadroom) : headroom(std::max(1, healthHeadroom)) {
+    // Tables are solved lazily on first query
+}
+
+CombatSolver::Outcome CombatSolver::solve(const CombatLoadout& player, const CombatLoadout& enemy,
+                                          bool isDaytime) {
+    std::unique_ptr<Character> playerCharacter = Board::createEnemy(player.race);
+    std::unique_ptr<Character> enemyCharacter = Board::createEnemy(enemy.race);
+    for (ItemId item : player.items) playerCharacter->getInventory().addItem(item);
+    for (ItemId item : enemy.items) enemyCharacter->getInventory().addItem(item);
+    return solve(*playerCharacter, *enemyCharacter, isDaytime);
+}
+
+CombatSolver::Outcome CombatSolver::solve(const Character& player, const Character& enemy, bool isDaytime) {
+    const int playerHealth = CombatSimulator::baseHealth(player);
+    const int enemyHealth = CombatSimulator::baseHealth(enemy);
+
+    // Duels that are already over
+    if (enemyHealth <= 0) return {1.0, 0.0, 0.0, static_cast<double>(enemy.getGoldValue()), 0.0};
+    if (playerHealth <= 0) return {0.0, 1.0, 0.0, 0.0, 0.0};
+
+    const Key key = makeKey(player, enemy, isDaytime);
+    auto found = cache.find(key);
+    if (found == cache.end() ||
+        playerHealth > found->second.maxPlayerHealth - headroom ||
+        enemyHealth > found->second.maxEnemyHealth - headroom) {
+        // First query for this matchup, or a character healed past the tracked range
+        int maxPlayer = playerHealth + headroom;
+        int maxEnemy = enemyHealth + headroom;
+        if (found != cache.end()) {
+            maxPlayer = std::max(maxPlayer, found->second.maxPlayerHealth);
+            maxEnemy = std::max(maxEnemy, found->second.maxEnemyHealth);
+        }
+        Table table = solveTable(CombatSimulator::buildMatchup(player, enemy, isDaytime), maxPlayer, maxEnemy);
+        found = cache.insert_or_assign(key, std::move(table)).first;
+    }
+    return found->second.at(playerHealth, enemyHealth);
+}
+
+bool CombatSolver::shouldAttack(const Character& player, const Character& enemy, bool isDaytime,
+                                double minWinProbability) {
+    return solve(player, enemy, isDaytime).winProbability >= minWinProbability;
+}
+
+CombatSolver::Outcome CombatSolver::solveMatchup(const CombatSimulator::Matchup& matchup, int healthHeadroom) {
+    if (matchup.enemyHealth <= 0) return {1.0, 0.0, 0.0, static_cast<double>(matchup.enemyGold), 0.0};
+    if (matchup.playerHealth <= 0) return {0.0, 1.0, 0.0, 0.0, 0.0};
+
+    healthHeadroom = std::max(1, healthHeadroom);
+    Table table = solveTable(matchup, matchup.playerHealth + healthHeadroom, matchup.enemyHealth + healthHeadroom);
+    return table.at(matchup.playerHealth, matchup.enemyHealth);
+}
+
+std::size_t CombatSolver::getCacheSize() const {
+    return cache.size();
+}
+
+void CombatSolver::clearCache() {
+    cache.clear();
+}
+
+CombatSolver::Key CombatSolver::makeKey(const Character& player, const Character& enemy, bool isDaytime) {
+    const Inventory::ItemStats& playerMods = player.getInventory().getTotalModifications();
+    const Inventory::ItemStats& enemyMods = enemy.getInventory().getTotalModifications();
+
+    Key key;
+    key.playerRace = player.getRaceId();
+    key.enemyRace = enemy.getRaceId();
+    key.isDaytime = isDaytime;
+    key.playerStats = {playerMods.attack, playerMods.defence, playerMods.health, playerMods.strength};
+    key.enemyStats = {enemyMods.attack, enemyMods.defence, enemyMods.health, enemyMods.strength};
+    return key;
+}
+
+CombatSolver::Table CombatSolver::solveTable(const CombatSimulator::Matchup& matchup, int maxPlayerHealth,
+                                             int maxEnemyHealth) {
+    const DamageDistribution playerHits = damageDistribution(matchup.playerAttack);
+    const DamageDistribution enemyHits = damageDistribution(matchup.enemyAttack);
+    const std::size_t stride = static_cast<std::size_t>(maxEnemyHealth) + 1;
+    const std::size_t states = (static_cast<std::size_t>(maxPlayerHealth) + 1) * stride;
+
+    Table table;
+    table.matchup = matchup;
+    table.maxPlayerHealth = maxPlayerHealth;
+    table.maxEnemyHealth = maxEnemyHealth;
+    table.win.assign(states, 0.0);
+    table.loss.assign(states, 0.0);
+    table.finalHealth.assign(states, 0.0);
+
+    // Gauss-Seidel value iteration. Damage only lowers health, so sweeping
+    // from low to high health resolves most dependencies in the first pass;
+    // further sweeps only propagate heals.
+    for (int sweep = 0; sweep < MAX_SWEEPS; ++sweep) {
+        double change = 0.0;
+
+        for (int p = 1; p <= maxPlayerHealth; ++p) {
+            for (int e = 1; e <= maxEnemyHealth; ++e) {
+                double win = 0.0;
+                double loss = 0.0;
+                double finalHealth = 0.0;
+                double stay = 0.0; // Probability the round pair returns to this state
+
+                for (const auto& playerHit : playerHits) {
+                    const int nextEnemy = applyDamage(e, playerHit.first, maxEnemyHealth);
+                    if (nextEnemy == 0) {
+                        // Enemy defeated; it does not counterattack
+                        win += playerHit.second;
+                        finalHealth += playerHit.second * p;
+                        continue;
+                    }
+
+                    for (const auto& enemyHit : enemyHits) {
+                        const double probability = playerHit.second * enemyHit.second;
+                        const int nextPlayer = applyDamage(p, enemyHit.first, maxPlayerHealth);
+                        if (nextPlayer == 0) {
+                            loss += probability;
+                        } else if (nextPlayer == p && nextEnemy == e) {
+                            stay += probability;
+                        } else {
+                            const std::size_t next = static_cast<std::size_t>(nextPlayer) * stride + nextEnemy;
+                            win += probability * table.win[next];
+                            loss += probability * table.loss[next];
+                            finalHealth += probability * table.finalHealth[next];
+                        }
+                    }
+                }
+
+                const double leave = 1.0 - stay;
+                if (leave <= 1e-15) {
+                    // Neither side can ever change this state: a permanent draw
+                    win = 0.0;
+                    loss = 0.0;
+                    finalHealth = p;
+                } else {
+                    win /= leave;
+                    loss /= leave;
+                    finalHealth /= leave;
+                }
+
+                const std::size_t index = static_cast<std::size_t>(p) * stride + e;
+                change = std::max(change, std::fabs(win - table.win[index]));
+                change = std::max(change, std::fabs(loss - table.loss[index]));
+                change = std::max(change, std::fabs(finalHealth - table.finalHealth[index]) / maxPlayerHealth);
+                table.win[index] = win;
+                table.loss[index] = loss;
+                table.finalHealth[index] = finalHealth;
+            }
+        }
+
+        if (change < TOLERANCE) break;
+    }
+    return table;
+}
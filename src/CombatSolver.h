@@ -0,0 +1,168 @@
+/**
+ * @file CombatSolver.h
+ * @brief Exact duel outcome solver over the health-state Markov chain
+ */
+
+#ifndef COMBATSOLVER_H
+#define COMBATSOLVER_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include "CombatSimulator.h"
+#include "Inventory.h"
+
+/**
+ * @class CombatSolver
+ * @brief Computes duel outcome probabilities without sampling
+ *
+ * A duel is a Markov chain on (player health, enemy health). Each state
+ * moves to the next by one player attack and, if the enemy survives, one
+ * enemy counterattack, with the chances and damage values of
+ * CombatSimulator::Exchange. The solver computes the absorption
+ * probabilities and expected final health for every state in one table
+ * per matchup. Any query at any current health is then a table lookup.
+ *
+ * Tables are cached by (race, item stat totals) of both sides plus
+ * isDaytime, since those fully determine the exchanges. Heals (Elf
+ * defences, Orcs at night) can raise health without limit, so each table
+ * stops at starting health plus a headroom, and heals past it are dropped.
+ * Getting there takes dozens of net heals in a row, so the result matches
+ * the real game to well beyond print precision.
+ *
+ * Not thread-safe; use one solver per thread.
+ */
+class CombatSolver {
+public:
+    /**
+     * @brief Default extra health levels tracked above the starting health
+     */
+    static constexpr int DEFAULT_HEADROOM = 48;
+
+    /**
+     * @struct Outcome
+     * @brief Exact duel outcome from a given state
+     */
+    struct Outcome {
+        double winProbability;      ///< Probability the player defeats the enemy
+        double lossProbability;     ///< Probability the player is defeated
+        double drawProbability;     ///< Probability neither side can ever be defeated
+        double expectedGold;        ///< Expected gold earned (gold value times win probability)
+        double expectedDamageTaken; ///< Expected player health lost by the end (negative if healed)
+    };
+
+    /**
+     * @brief Constructor for CombatSolver
+     * @param healthHeadroom Health levels tracked above the starting health
+     */
+    explicit CombatSolver(int healthHeadroom = DEFAULT_HEADROOM);
+
+    /**
+     * @brief Solve a duel between two loadouts at full health
+     * @param player Player loadout
+     * @param enemy Enemy loadout
+     * @param isDaytime Time of day
+     * @return Outcome Exact outcome
+     */
+    Outcome solve(const CombatLoadout& player, const CombatLoadout& enemy, bool isDaytime);
+
+    /**
+     * @brief Solve a duel between two existing characters at their current health
+     * @param player Player character
+     * @param enemy Enemy character
+     * @param isDaytime Time of day
+     * @return Outcome Exact outcome
+     */
+    Outcome solve(const Character& player, const Character& enemy, bool isDaytime);
+
+    /**
+     * @brief Decide whether attacking an enemy is worth it
+     * @param player Player character
+     * @param enemy Enemy character
+     * @param isDaytime Time of day
+     * @param minWinProbability Win probability required to attack
+     * @return bool True if the player wins at least that often
+     */
+    bool shouldAttack(const Character& player, const Character& enemy, bool isDaytime,
+                      double minWinProbability = 0.5);
+
+    /**
+     * @brief Solve a prepared matchup without touching the cache
+     * @param matchup Matchup from CombatSimulator::buildMatchup()
+     * @param healthHeadroom Health levels tracked above the starting health
+     * @return Outcome Exact outcome from the matchup's starting health
+     */
+    static Outcome solveMatchup(const CombatSimulator::Matchup& matchup, int healthHeadroom = DEFAULT_HEADROOM);
+
+    /**
+     * @brief Get the number of cached matchup tables
+     * @return std::size_t Cache entries
+     */
+    std::size_t getCacheSize() const;
+
+    /**
+     * @brief Drop all cached tables
+     */
+    void clearCache();
+
+private:
+    /**
+     * @struct Key
+     * @brief Everything that determines a matchup's exchanges
+     */
+    struct Key {
+        Race playerRace;
+        Race enemyRace;
+        bool isDaytime;
+        std::array<int, 4> playerStats; ///< Item attack, defence, health, strength totals
+        std::array<int, 4> enemyStats;
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    /**
+     * @struct Table
+     * @brief Solved chain for one matchup, indexed by (player health, enemy health)
+     */
+    struct Table {
+        CombatSimulator::Matchup matchup;
+        int maxPlayerHealth;
+        int maxEnemyHealth;
+        std::vector<double> win;         ///< Win probability per state
+        std::vector<double> loss;        ///< Loss probability per state
+        std::vector<double> finalHealth; ///< Expected player health at the end per state
+
+        /**
+         * @brief Read the outcome of a state
+         * @param playerHealth Current player health (1 to maxPlayerHealth)
+         * @param enemyHealth Current enemy health (1 to maxEnemyHealth)
+         * @return Outcome Outcome from that state
+         */
+        Outcome at(int playerHealth, int enemyHealth) const;
+    };
+
+    int headroom;
+    std::unordered_map<Key, Table, KeyHash> cache;
+
+    /**
+     * @brief Build the cache key for two characters
+     */
+    static Key makeKey(const Character& player, const Character& enemy, bool isDaytime);
+
+    /**
+     * @brief Solve every state of a matchup up to the given health bounds
+     * @param matchup Exchanges and gold value
+     * @param maxPlayerHealth Highest player health tracked
+     * @param maxEnemyHealth Highest enemy health tracked
+     * @return Table Solved chain
+     */
+    static Table solveTable(const CombatSimulator::Matchup& matchup, int maxPlayerHealth, int maxEnemyHealth);
+};
+
+#endif // COMBATSOLVER_H
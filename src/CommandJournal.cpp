@@ -0,0 +1,163 @@
+/**
+ * @file CommandJournal.cpp
+ * @brief Implementation of CommandJournal class
+ */
+
+#include "CommandJournal.h"
+#include "Game.h"
+#include "GameSnapshot.h"
+#include "RaceTraits.h"
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<JournalHeader>::value, "header is copied as raw bytes");
+static_assert(sizeof(JournalHeader) % 8 == 0, "header has no trailing padding");
+
+namespace {
+
+constexpr char MAGIC[8] = {'S', 'O', 'M', 'E', 'J', 'R', 'N', 'L'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr char COMMAND_RECORD = 'C';
+constexpr char CHECKPOINT_RECORD = 'H';
+
+} // namespace
+
+CommandJournal::CommandJournal(const std::string& path, const JournalHeader& header)
+    : out(path, std::ios::binary | std::ios::trunc) {
+    if (!out) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    JournalHeader stamped = header;
+    std::memcpy(stamped.magic, MAGIC, sizeof(MAGIC));
+    stamped.version = VERSION;
+    stamped.byteOrder = BYTE_ORDER_MARK;
+    out.write(reinterpret_cast<const char*>(&stamped), sizeof(stamped));
+    buffer.reserve(BUFFER_BYTES);
+}
+
+CommandJournal::~CommandJournal() {
+    try {
+        flush();
+    } catch (const std::exception&) {
+        // Nothing can be reported from a destructor; the journal ends early
+    }
+}
+
+void CommandJournal::checkpoint(std::uint64_t commandCount, std::uint64_t stateHash) {
+    if (buffer.size() + 1 + 2 * sizeof(std::uint64_t) > BUFFER_BYTES) {
+        flush();
+    }
+    buffer.push_back(CHECKPOINT_RECORD);
+    const char* count = reinterpret_cast<const char*>(&commandCount);
+    const char* hash = reinterpret_cast<const char*>(&stateHash);
+    buffer.insert(buffer.end(), count, count + sizeof(commandCount));
+    buffer.insert(buffer.end(), hash, hash + sizeof(stateHash));
+}
+
+void CommandJournal::flush() {
+    if (!buffer.empty()) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Failed to write command journal");
+    }
+}
+
+std::vector<CommandJournal::Entry> CommandJournal::read(const std::string& path, JournalHeader& header) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Journal is truncated");
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a command journal");
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported journal version " + std::to_string(header.version));
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        throw std::runtime_error("Journal was written with a different byte order");
+    }
+    if (header.width <= 0 || header.height <= 0 || header.playerRace >= RACE_COUNT ||
+        header.playerNameLength > sizeof(header.playerName)) {
+        throw std::runtime_error("Journal header is inconsistent");
+    }
+
+    std::vector<Entry> entries;
+    char tag;
+    while (in.get(tag)) {
+        Entry entry;
+        if (tag == COMMAND_RECORD) {
+            unsigned char length[2];
+            if (!in.read(reinterpret_cast<char*>(length), 2)) {
+                throw std::runtime_error("Journal is truncated");
+            }
+            entry.command.resize(length[0] | (static_cast<std::size_t>(length[1]) << 8));
+            if (!in.read(&entry.command[0], static_cast<std::streamsize>(entry.command.size()))) {
+                throw std::runtime_error("Journal is truncated");
+            }
+        } else if (tag == CHECKPOINT_RECORD) {
+            entry.checkpoint = true;
+            if (!in.read(reinterpret_cast<char*>(&entry.commandCount), sizeof(entry.commandCount)) ||
+                !in.read(reinterpret_cast<char*>(&entry.stateHash), sizeof(entry.stateHash))) {
+                throw std::runtime_error("Journal is truncated");
+            }
+        } else {
+            throw std::runtime_error("Journal contains an unknown record");
+        }
+        entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+/**
+ * @brief Re-execute a journal and compare every checkpoint
+ * @param path Journal file
+ * @return ReplayResult Counts and whether every check passed
+ *
+ * Pseudo-code:
+ * 1. Read the header and records
+ * 2. Start Game(gameSeed) on the recorded board size, race and name
+ * 3. Check the board seed and combat state against the header
+ * 4. Execute each command; at each checkpoint compare the state hash
+ */
+CommandJournal::ReplayResult CommandJournal::replay(const std::string& path) {
+    JournalHeader header;
+    const std::vector<Entry> entries = read(path, header);
+
+    std::string race = raceTraits(static_cast<Race>(header.playerRace)).name;
+    for (char& c : race) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    Game game(header.gameSeed);
+    game.initializeGame(header.width, header.height, race, std::string(header.playerName, header.playerNameLength));
+
+    ReplayResult result;
+    const auto combatState = game.combatSystem->getRng().getState();
+    result.startMatched = game.board->getSeed() == header.boardSeed &&
+                          std::equal(combatState.begin(), combatState.end(), std::begin(header.combatState));
+
+    for (const Entry& entry : entries) {
+        if (entry.checkpoint) {
+            ++result.checkpoints;
+            result.finalHash = GameSnapshot::stateHash(game);
+            if (entry.commandCount != result.commands || entry.stateHash != result.finalHash) {
+                ++result.mismatches;
+            }
+        } else {
+            game.execute(entry.command);
+            ++result.commands;
+        }
+    }
+    if (entries.empty() || !entries.back().checkpoint) {
+        result.finalHash = GameSnapshot::stateHash(game);
+    }
+    return result;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file CommandJournal.h
+ * @brief Compact binary log of a session's commands for deterministic replay
+ */
+
+#ifndef COMMANDJOURNAL_H
+#define COMMANDJOURNAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct JournalHeader
+ * @brief Fixed-size header: everything needed to rebuild the session's start
+ */
+struct JournalHeader {
+    char magic[8];              ///< "SOMEJRNL"
+    std::uint32_t version;      ///< CommandJournal::VERSION
+    std::uint32_t byteOrder;    ///< 0x01020304 as written
+    std::uint64_t gameSeed;     ///< Seed passed to Game(seed); board and combat streams derive from it
+    std::uint64_t boardSeed;    ///< Board generation seed, checked on replay
+    std::uint64_t combatState[4]; ///< Combat generator state at the start, checked on replay
+    std::int32_t width;         ///< Board width passed to Game::initializeGame()
+    std::int32_t height;        ///< Board height passed to Game::initializeGame()
+    std::uint8_t playerRace;    ///< Race code
+    std::uint8_t playerNameLength;
+    std::uint8_t reserved[6];
+    char playerName[64];
+};
+
+/**
+ * @class CommandJournal
+ * @brief Appends commands to a buffered binary journal
+ *
+ * After the header the file is a sequence of records:
+ * - 'C', 2-byte length, command bytes: one executed command
+ * - 'H', 8-byte command count, 8-byte state hash: a checkpoint
+ *
+ * Records are gathered in a 64 KiB buffer and written in one call when it
+ * fills, so appending a command is a bounds check and a memcpy. A
+ * checkpoint is written when the game finishes its journal, letting a
+ * replay prove it reached the same state.
+ */
+class CommandJournal {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::size_t BUFFER_BYTES = 64 * 1024;
+
+    /**
+     * @struct Entry
+     * @brief One record read back from a journal
+     */
+    struct Entry {
+        bool checkpoint = false;
+        std::string command;        ///< Command text (commands only)
+        std::uint64_t commandCount = 0; ///< Commands executed before the checkpoint
+        std::uint64_t stateHash = 0;    ///< GameSnapshot::stateHash() at the checkpoint
+    };
+
+    /**
+     * @brief Create a journal file and write its header
+     * @param path File to create or replace
+     * @param header Session start parameters (magic, version and byte order are filled in)
+     * @throws std::runtime_error if the file cannot be created
+     */
+    CommandJournal(const std::string& path, const JournalHeader& header);
+
+    /**
+     * @brief Destructor - writes any buffered records
+     */
+    ~CommandJournal();
+
+    CommandJournal(const CommandJournal&) = delete;
+    CommandJournal& operator=(const CommandJournal&) = delete;
+
+    /**
+     * @brief Record one command
+     * @param command Command text exactly as executed (cut at 65535 bytes)
+     */
+    void append(std::string_view command) {
+        const std::size_t length = std::min<std::size_t>(command.size(), 0xFFFF);
+        if (buffer.size() + 3 + length > BUFFER_BYTES) {
+            flush();
+        }
+        buffer.push_back('C');
+        buffer.push_back(static_cast<char>(length & 0xFF));
+        buffer.push_back(static_cast<char>(length >> 8));
+        buffer.insert(buffer.end(), command.data(), command.data() + length);
+    }
+
+    /**
+     * @brief Record a state checkpoint
+     * @param commandCount Commands executed so far
+     * @param stateHash Hash of the game state after them
+     */
+    void checkpoint(std::uint64_t commandCount, std::uint64_t stateHash);
+
+    /**
+     * @brief Write buffered records to the file
+     * @throws std::runtime_error on a write error
+     */
+    void flush();
+
+    /**
+     * @brief Read a whole journal
+     * @param path Journal file
+     * @param header Output header
+     * @return std::vector<Entry> Records in order
+     * @throws std::runtime_error if the file is missing, of another version, or corrupt
+     */
+    static std::vector<Entry> read(const std::string& path, JournalHeader& header);
+
+    /**
+     * @struct ReplayResult
+     * @brief Outcome of replaying a journal
+     */
+    struct ReplayResult {
+        std::uint64_t commands = 0;     ///< Commands executed
+        std::uint64_t checkpoints = 0;  ///< Checkpoints compared
+        std::uint64_t mismatches = 0;   ///< Checkpoints whose state hash differed
+        std::uint64_t finalHash = 0;    ///< State hash after the last command
+        bool startMatched = false;      ///< Board seed and combat state matched the header
+    };
+
+    /**
+     * @brief Re-execute a journal and compare every checkpoint
+     * @param path Journal file
+     * @return ReplayResult Counts and whether every check passed
+     * @throws std::runtime_error if the journal cannot be read
+     *
+     * Builds Game(gameSeed) with the recorded board size, race and name,
+     * then feeds the commands to Game::execute() with no console I/O.
+     */
+    static ReplayResult replay(const std::string& path);
+
+private:
+    std::ofstream out;
+    std::vector<char> buffer;
+};
+
+#endif // COMMANDJOURNAL_H
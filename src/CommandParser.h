@@ -0,0 +1,207 @@
+/**
+ * @file CommandParser.h
+ * @brief Allocation-free command tokenizer with a compile-time perfect-hash verb table
+ */
+
+#ifndef COMMANDPARSER_H
+#define COMMANDPARSER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @enum Verb
+ * @brief Command verbs understood by Game::execute()
+ */
+enum class Verb : std::uint8_t {
+    North,
+    South,
+    East,
+    West,
+    PickUp,
+    Drop,
+    Attack,
+    Look,
+    Inventory,
+    Quit,
+    Unknown
+};
+
+/**
+ * @struct ParsedCommand
+ * @brief A verb plus the rest of the line, viewing the caller's string
+ */
+struct ParsedCommand {
+    Verb verb = Verb::Unknown;
+    std::string_view argument; ///< Trimmed text after the verb, original case
+};
+
+/**
+ * @struct VerbAlias
+ * @brief One spelling of a verb
+ */
+struct VerbAlias {
+    std::string_view word;
+    Verb verb;
+};
+
+/**
+ * @brief Every accepted spelling; "pick" is only valid as "pick up"
+ */
+constexpr VerbAlias VERB_ALIASES[] = {
+    {"north", Verb::North},  {"n", Verb::North},
+    {"south", Verb::South},  {"s", Verb::South},
+    {"east", Verb::East},    {"e", Verb::East},
+    {"west", Verb::West},    {"w", Verb::West},
+    {"pick", Verb::PickUp},  {"p", Verb::PickUp},
+    {"drop", Verb::Drop},    {"d", Verb::Drop},
+    {"attack", Verb::Attack}, {"a", Verb::Attack},
+    {"look", Verb::Look},    {"l", Verb::Look},
+    {"inventory", Verb::Inventory}, {"i", Verb::Inventory},
+    {"exit", Verb::Quit},    {"quit", Verb::Quit}
+};
+
+constexpr std::size_t VERB_ALIAS_COUNT = sizeof(VERB_ALIASES) / sizeof(VERB_ALIASES[0]);
+constexpr std::size_t VERB_TABLE_SIZE = 64;
+constexpr std::uint8_t VERB_TABLE_EMPTY = 0xFF;
+
+/**
+ * @brief ASCII lowercase of one character
+ */
+constexpr char foldCase(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+/**
+ * @brief Compare two words ignoring ASCII case
+ */
+constexpr bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (foldCase(a[i]) != foldCase(b[i])) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Case-insensitive FNV-1a hash of a word
+ * @param word Word to hash
+ * @param seed Value mixed into the offset basis
+ * @return std::uint32_t Hash value
+ */
+constexpr std::uint32_t hashVerb(std::string_view word, std::uint32_t seed) {
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (char c : word) {
+        hash ^= static_cast<unsigned char>(foldCase(c));
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+/**
+ * @brief Check whether a seed sends every alias to its own table slot
+ */
+constexpr bool isPerfectVerbSeed(std::uint32_t seed) {
+    bool used[VERB_TABLE_SIZE] = {};
+    for (const VerbAlias& alias : VERB_ALIASES) {
+        std::size_t slot = hashVerb(alias.word, seed) % VERB_TABLE_SIZE;
+        if (used[slot]) return false;
+        used[slot] = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Find the first collision-free seed (evaluated by the compiler)
+ */
+constexpr std::uint32_t findVerbSeed() {
+    std::uint32_t seed = 0;
+    while (!isPerfectVerbSeed(seed)) ++seed;
+    return seed;
+}
+
+constexpr std::uint32_t VERB_SEED = findVerbSeed();
+
+/**
+ * @brief Build the slot -> alias index table for VERB_SEED
+ */
+constexpr std::array<std::uint8_t, VERB_TABLE_SIZE> buildVerbTable() {
+    std::array<std::uint8_t, VERB_TABLE_SIZE> table{};
+    for (std::uint8_t& slot : table) slot = VERB_TABLE_EMPTY;
+    for (std::size_t i = 0; i < VERB_ALIAS_COUNT; ++i) {
+        table[hashVerb(VERB_ALIASES[i].word, VERB_SEED) % VERB_TABLE_SIZE] = static_cast<std::uint8_t>(i);
+    }
+    return table;
+}
+
+constexpr std::array<std::uint8_t, VERB_TABLE_SIZE> VERB_TABLE = buildVerbTable();
+
+/**
+ * @brief Resolve one word to its verb
+ * @param word Verb as typed, any case
+ * @return Verb Matching verb, or Verb::Unknown
+ *
+ * One hash, one table load and one compare; no allocation.
+ */
+constexpr Verb lookupVerb(std::string_view word) {
+    if (word.empty() || word.size() > 9) return Verb::Unknown;
+    const std::uint8_t index = VERB_TABLE[hashVerb(word, VERB_SEED) % VERB_TABLE_SIZE];
+    if (index == VERB_TABLE_EMPTY || !equalsIgnoreCase(VERB_ALIASES[index].word, word)) return Verb::Unknown;
+    return VERB_ALIASES[index].verb;
+}
+
+/**
+ * @brief Canonical (first listed) spelling of a verb
+ * @param verb Verb
+ * @return std::string_view Name such as "north", or "" for Verb::Unknown
+ */
+constexpr std::string_view verbName(Verb verb) {
+    for (const VerbAlias& alias : VERB_ALIASES) {
+        if (alias.verb == verb) return alias.word;
+    }
+    return {};
+}
+
+/**
+ * @brief Split a command line into verb and argument without copying
+ * @param command Command line, e.g. "North", "drop 2", "drop Ring of Life"
+ * @return ParsedCommand Verb and trimmed argument viewing @p command
+ *
+ * Pseudo-code:
+ * 1. Trim spaces at both ends
+ * 2. The verb is everything up to the first space
+ * 3. The argument is the rest with leading spaces skipped
+ * 4. "pick" is only a verb when the argument is "up"
+ * 5. Only "drop" takes an argument; any other verb followed by one is Unknown
+ */
+constexpr ParsedCommand parseCommand(std::string_view command) {
+    const std::size_t first = command.find_first_not_of(' ');
+    if (first == std::string_view::npos) return {};
+    command = command.substr(first, command.find_last_not_of(' ') - first + 1);
+
+    const std::size_t space = command.find(' ');
+    std::string_view word = command.substr(0, space);
+    std::string_view argument;
+    if (space != std::string_view::npos) {
+        argument = command.substr(command.find_first_not_of(' ', space));
+    }
+
+    ParsedCommand parsed{lookupVerb(word), argument};
+    if (parsed.verb == Verb::PickUp && word.size() > 1) {
+        if (!equalsIgnoreCase(argument, "up")) return {};
+        parsed.argument = {};
+    }
+    if (parsed.verb != Verb::Drop && !parsed.argument.empty()) return {};
+    return parsed;
+}
+
+static_assert(lookupVerb("NoRtH") == Verb::North, "verb lookup must ignore case");
+static_assert(lookupVerb("nort") == Verb::Unknown, "verb lookup must reject prefixes");
+static_assert(parseCommand("  Pick  up ").verb == Verb::PickUp, "\"pick up\" is a two-word verb");
+static_assert(parseCommand("drop Ring of Life").argument == "Ring of Life", "argument keeps its text");
+static_assert(parseCommand("north foo").verb == Verb::Unknown, "movement takes no argument");
+static_assert(parseCommand("exit now").verb == Verb::Unknown, "quitting takes no argument");
+
+#endif // COMMANDPARSER_H
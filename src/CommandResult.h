@@ -0,0 +1,111 @@
+/**
+ * @file CommandResult.h
+ * @brief Structured outcome of one game command
+ */
+
+#ifndef COMMANDRESULT_H
+#define COMMANDRESULT_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @enum CommandStatus
+ * @brief How a command was handled
+ */
+enum class CommandStatus : std::uint8_t {
+    Ok,          ///< Command carried out (possibly a no-op, e.g. an attack that missed)
+    Rejected,    ///< Valid command that could not be carried out (blocked move, nothing to pick up)
+    NeedsChoice, ///< Command needs an argument; the client should list the options
+    Unknown,     ///< Unrecognised command
+    NotRunning   ///< No game in progress
+};
+
+/**
+ * @enum GameEvent
+ * @brief What happened, with the meaning of CommandEvent::subject and value
+ */
+enum class GameEvent : std::uint8_t {
+    Moved,            ///< subject: Verb direction
+    OutOfBounds,      ///< subject: Verb direction
+    LocationShown,    ///< Current square described (look)
+    NoItemHere,       ///< Nothing to pick up
+    PickedUp,         ///< subject: ItemId
+    TooHeavy,         ///< subject: ItemId that could not be carried
+    SquareOccupied,   ///< Cannot drop onto a square holding an item
+    InventoryEmpty,   ///< Nothing to drop
+    DropChoices,      ///< Drop needs a choice from the inventory; value: item count
+    DropCancelled,    ///< "drop 0"
+    InvalidChoice,    ///< Drop argument matched no inventory slot
+    Dropped,          ///< subject: ItemId
+    DropFailed,       ///< Item could not be moved from the inventory to the square
+    NoEnemy,          ///< Nothing to attack
+    CombatStarted,    ///< Attack begins
+    PlayerHit,        ///< subject: enemy Race; value: enemy health left
+    PlayerMissed,     ///< Player's attack missed
+    EnemyDefeated,    ///< subject: enemy Race; value: gold gained
+    EnemyHit,         ///< subject: enemy Race; value: player health left
+    EnemyMissed,      ///< subject: enemy Race
+    PlayerDefeated,   ///< Player died; the game is over
+    InventoryShown,   ///< Inventory listed; value: gold
+    GameEnded,        ///< Player quit; value: gold collected
+    UnknownCommand,   ///< Verb not recognised
+    NotRunning        ///< No game in progress
+};
+
+/**
+ * @struct CommandEvent
+ * @brief One event code with its numeric fields (8 bytes)
+ */
+struct CommandEvent {
+    GameEvent code;
+    std::uint8_t subject;
+    std::int32_t value;
+};
+
+/**
+ * @struct CommandResult
+ * @brief Everything a client needs after one command, with no text and no allocation
+ *
+ * Handlers record events; TextRenderer turns them into the console text
+ * only when a human is reading.
+ */
+struct CommandResult {
+    /// Most events any command produces (an attack: start, hit, counter, defeat)
+    static constexpr std::size_t MAX_EVENTS = 4;
+
+    CommandStatus status = CommandStatus::Ok;
+    bool gameOver = false;      ///< True if this command ended the game
+    std::uint8_t eventCount = 0;
+    std::array<CommandEvent, MAX_EVENTS> events{};
+
+    /**
+     * @brief Create a result holding a single event
+     * @param status Command status
+     * @param code Event code
+     * @param subject Event subject (race, item or direction id)
+     * @param value Event value
+     * @return CommandResult New result
+     */
+    static CommandResult of(CommandStatus status, GameEvent code, std::uint8_t subject = 0, std::int32_t value = 0) {
+        CommandResult result;
+        result.status = status;
+        result.add(code, subject, value);
+        return result;
+    }
+
+    /**
+     * @brief Append an event
+     * @param code Event code
+     * @param subject Event subject (race, item or direction id)
+     * @param value Event value
+     */
+    void add(GameEvent code, std::uint8_t subject = 0, std::int32_t value = 0) {
+        if (eventCount < MAX_EVENTS) events[eventCount++] = CommandEvent{code, subject, value};
+    }
+
+    const CommandEvent* begin() const { return events.data(); }
+    const CommandEvent* end() const { return events.data() + eventCount; }
+};
+
+#endif // COMMANDRESULT_H
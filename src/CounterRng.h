@@ -0,0 +1,86 @@
+/**
+ * @file CounterRng.h
+ * @brief Counter-based random number generator (Philox4x32-10)
+ */
+
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @class CounterRng
+ * @brief Stateless Philox4x32-10 generator keyed by a 64-bit seed
+ *
+ * Each call maps (seed, counter) to four independent 32-bit words, so any
+ * cell, row or tile can draw its random numbers without touching shared
+ * state. The same seed and counter always give the same output, no matter
+ * which thread asks or in which order.
+ */
+class CounterRng {
+public:
+    using Block = std::array<std::uint32_t, 4>;
+
+    /**
+     * @brief Constructor for CounterRng
+     * @param seed 64-bit key selecting the random stream
+     */
+    explicit CounterRng(std::uint64_t seed)
+        : key0(static_cast<std::uint32_t>(seed)), key1(static_cast<std::uint32_t>(seed >> 32)) {}
+
+    /**
+     * @brief Generate the block of four words for a counter value
+     * @param counter Position in the stream (e.g. a cell index)
+     * @param stream Sub-stream selector for independent uses of one counter
+     * @return Block Four uniformly distributed 32-bit words
+     */
+    Block operator()(std::uint64_t counter, std::uint64_t stream = 0) const {
+        std::uint32_t c0 = static_cast<std::uint32_t>(counter);
+        std::uint32_t c1 = static_cast<std::uint32_t>(counter >> 32);
+        std::uint32_t c2 = static_cast<std::uint32_t>(stream);
+        std::uint32_t c3 = static_cast<std::uint32_t>(stream >> 32);
+        std::uint32_t k0 = key0;
+        std::uint32_t k1 = key1;
+
+        // Ten Philox rounds with Weyl-sequence key schedule
+        for (int round = 0; round < 10; ++round) {
+            std::uint64_t p0 = std::uint64_t(0xD2511F53u) * c0;
+            std::uint64_t p1 = std::uint64_t(0xCD9E8D57u) * c2;
+            std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+            std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+            c1 = static_cast<std::uint32_t>(p1);
+            c3 = static_cast<std::uint32_t>(p0);
+            c0 = n0;
+            c2 = n2;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return Block{c0, c1, c2, c3};
+    }
+
+    /**
+     * @brief Map a random word to an integer in [0, bound)
+     * @param word Uniform 32-bit word
+     * @param bound Exclusive upper bound
+     * @return std::uint32_t Value in range
+     */
+    static std::uint32_t bounded(std::uint32_t word, std::uint32_t bound) {
+        return static_cast<std::uint32_t>((std::uint64_t(word) * bound) >> 32);
+    }
+
+    /**
+     * @brief Map a random word to a double in [0, 1)
+     * @param word Uniform 32-bit word
+     * @return double Value in range
+     */
+    static double toUnit(std::uint32_t word) {
+        return word * (1.0 / 4294967296.0);
+    }
+
+private:
+    std::uint32_t key0;
+    std::uint32_t key1;
+};
+
+#endif // COUNTERRNG_H
@@ -4,27 +4,34 @@
  */
 
 #include "Dwarf.h"
+#include "RaceTraits.h"
 
 Dwarf::Dwarf(std::string charName)
-    : Character(charName, 30, 20, 50, 130) {
+    : Character(charName, raceTraits(Race::Dwarf).attack, raceTraits(Race::Dwarf).defence,
+                raceTraits(Race::Dwarf).health, raceTraits(Race::Dwarf).strength) {
     // Base stats passed to Character constructor
 }
 
 double Dwarf::getAttackChance(bool isDaytime) const {
     // Dwarfs have 2/3 attack chance
-    return 2.0 / 3.0;
+    return raceTraits(Race::Dwarf).attackChance[isDaytime];
 }
 
 double Dwarf::getDefenceChance(bool isDaytime) const {
     // Dwarfs have 2/3 defence chance
-    return 2.0 / 3.0;
+    return raceTraits(Race::Dwarf).defenceChance[isDaytime];
 }
 
-int Dwarf::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const {
+int Dwarf::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                    double effectRoll) const {
     // Dwarf special ability: Successful defences never cause damage
-    return 0;
+    return raceTraits(Race::Dwarf).defenceRule[isDaytime].apply(attackerAttack, getDefence(), effectRoll);
 }
 
 std::string Dwarf::getRace() const {
-    return "Dwarf";
+    return raceTraits(Race::Dwarf).name;
+}
+
+Race Dwarf::getRaceId() const {
+    return Race::Dwarf;
 }
@@ -4,29 +4,34 @@
  */
 
 #include "Elf.h"
+#include "RaceTraits.h"
 
 Elf::Elf(std::string charName)
-    : Character(charName, 40, 10, 40, 70) {
+    : Character(charName, raceTraits(Race::Elf).attack, raceTraits(Race::Elf).defence,
+                raceTraits(Race::Elf).health, raceTraits(Race::Elf).strength) {
     // Base stats passed to Character constructor
 }
 
 double Elf::getAttackChance(bool isDaytime) const {
     // Elfs have 1/1 attack chance (always successful)
-    return 1.0;
+    return raceTraits(Race::Elf).attackChance[isDaytime];
 }
 
 double Elf::getDefenceChance(bool isDaytime) const {
     // Elfs have 1/4 defence chance
-    return 1.0 / 4.0;
+    return raceTraits(Race::Elf).defenceChance[isDaytime];
 }
 
-int Elf::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const {
+int Elf::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                  double effectRoll) const {
     // Elf special ability: Successful defences always increase health by 1
-    // Note: This would require modifying health, but we return damage here
-    // The combat system will handle the health increase
-    return -1; // Negative damage means health increase
+    return raceTraits(Race::Elf).defenceRule[isDaytime].apply(attackerAttack, getDefence(), effectRoll);
 }
 
 std::string Elf::getRace() const {
-    return "Elf";
+    return raceTraits(Race::Elf).name;
+}
+
+Race Elf::getRaceId() const {
+    return Race::Elf;
 }
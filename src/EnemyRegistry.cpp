@@ -0,0 +1,141 @@
+/**
+ * @file EnemyRegistry.cpp
+ * @brief Implementation of EnemyRegistry class
+ */
+
+#include "EnemyRegistry.h"
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Highest generation a slot reaches; the slot is retired after it
+ */
+constexpr std::uint32_t MAX_GENERATION = (std::uint32_t(1) << (32 - EnemyRegistry::INDEX_BITS)) - 1;
+
+} // namespace
+
+EnemyHandle EnemyRegistry::create(Race race, int health, std::size_t cell) {
+    if (races.size() >= CAPACITY) {
+        throw std::length_error("EnemyRegistry is full");
+    }
+    const std::uint32_t dense = static_cast<std::uint32_t>(races.size());
+    const std::uint32_t slot = takeSlot(dense);
+    races.push_back(static_cast<std::uint8_t>(race));
+    healths.push_back(health);
+    cells.push_back(static_cast<std::uint32_t>(cell));
+    owners.push_back(slot);
+    return handleOf(slot);
+}
+
+/**
+ * @brief Remove an enemy; its handle and all copies of it stop resolving
+ *
+ * Pseudo-code:
+ * 1. Ignore handles whose generation no longer matches their slot
+ * 2. Move the last entry into the removed one and repoint its slot
+ * 3. Advance the slot's generation and free it, unless the generation is spent
+ */
+void EnemyRegistry::destroy(EnemyHandle handle) {
+    if (!contains(handle)) {
+        return;
+    }
+    const std::uint32_t slot = slotOf(handle);
+    const std::uint32_t dense = slots[slot].dense;
+    const std::uint32_t last = static_cast<std::uint32_t>(races.size() - 1);
+    if (dense != last) {
+        races[dense] = races[last];
+        healths[dense] = healths[last];
+        cells[dense] = cells[last];
+        owners[dense] = owners[last];
+        slots[owners[dense]].dense = dense;
+    }
+    races.pop_back();
+    healths.pop_back();
+    cells.pop_back();
+    owners.pop_back();
+
+    // A spent slot is never reused, so no handle can ever come back to life
+    if (slots[slot].generation < MAX_GENERATION) {
+        ++slots[slot].generation;
+        freeSlots.push_back(slot);
+    } else {
+        slots[slot].generation = 0;
+    }
+}
+
+std::size_t EnemyRegistry::extend(std::size_t count) {
+    if (count > CAPACITY - races.size() || count > freeSlots.size() + (CAPACITY - slots.size())) {
+        throw std::length_error("EnemyRegistry is full");
+    }
+    const std::size_t first = races.size();
+    races.resize(first + count);
+    healths.resize(first + count);
+    cells.resize(first + count);
+    owners.resize(first + count);
+    for (std::size_t i = first; i < first + count; ++i) {
+        owners[i] = takeSlot(static_cast<std::uint32_t>(i));
+    }
+    return first;
+}
+
+EnemyHandle EnemyRegistry::place(std::size_t index, Race race, int health, std::size_t cell) {
+    races[index] = static_cast<std::uint8_t>(race);
+    healths[index] = health;
+    cells[index] = static_cast<std::uint32_t>(cell);
+    return handleOf(owners[index]);
+}
+
+void EnemyRegistry::clear() {
+    while (!owners.empty()) {
+        destroy(handleOf(owners.back()));
+    }
+}
+
+void EnemyRegistry::reset() {
+    races.clear();
+    healths.clear();
+    cells.clear();
+    owners.clear();
+    slots.clear();
+    freeSlots.clear();
+}
+
+bool EnemyRegistry::contains(EnemyHandle handle) const {
+    const std::uint32_t slot = slotOf(handle);
+    return handle != NONE && slot < slots.size() && slots[slot].generation != 0 &&
+           handleOf(slot) == handle && slots[slot].dense < races.size() && owners[slots[slot].dense] == slot;
+}
+
+const char* EnemyRegistry::getName(Race race) {
+    switch (race) {
+    case Race::Elf:
+        return "Bad Elf";
+    case Race::Dwarf:
+        return "Tiny Dwarf";
+    case Race::Hobbit:
+        return "Clone Hobbit";
+    case Race::Orc:
+        return "Orcy Orc";
+    case Race::Human:
+    default:
+        return "Evil Human";
+    }
+}
+
+std::uint32_t EnemyRegistry::takeSlot(std::uint32_t dense) {
+    std::uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        if (slots.size() >= CAPACITY) {
+            // Every slot index is taken or spent
+            throw std::length_error("EnemyRegistry has no handles left");
+        }
+        slot = static_cast<std::uint32_t>(slots.size());
+        slots.push_back(Slot{0, 1});
+    }
+    slots[slot].dense = dense;
+    return slot;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file EnemyRegistry.h
+ * @brief Dense component storage for the enemies of a board, addressed by generational handles
+ */
+
+#ifndef ENEMYREGISTRY_H
+#define ENEMYREGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Character.h"
+
+/**
+ * @brief 32-bit reference to an enemy in an EnemyRegistry
+ *
+ * The low INDEX_BITS select a slot, the rest hold the slot's generation,
+ * which changes whenever the slot's enemy is destroyed. A handle kept
+ * past its enemy's death therefore stops resolving instead of naming
+ * whichever enemy reuses the slot.
+ */
+using EnemyHandle = std::uint32_t;
+
+/**
+ * @class EnemyRegistry
+ * @brief Owns every enemy of a board (or chunk) as packed components
+ *
+ * An enemy is its race, its current health and the cell it stands on;
+ * its other stats come from RACE_TRAITS, and enemies carry no items.
+ * The components live in parallel arrays with one entry per live enemy,
+ * kept packed by moving the last entry into any hole, so a system that
+ * visits every enemy scans a few contiguous arrays in no particular
+ * order. Squares hold only a handle; copying one costs nothing and no
+ * reference count is involved.
+ *
+ * Creating and destroying enemies is not thread-safe. Reads, and writes
+ * to distinct entries (setHealth(), setCell(), getHealths()), may run on
+ * several threads at once, as may place() on the entries of one extend().
+ */
+class EnemyRegistry {
+public:
+    /**
+     * @brief Bits of a handle that select the slot
+     */
+    static constexpr int INDEX_BITS = 26;
+
+    /**
+     * @brief Handle that names no enemy
+     */
+    static constexpr EnemyHandle NONE = 0;
+
+    /**
+     * @brief Most enemies a registry can hold at once
+     */
+    static constexpr std::size_t CAPACITY = std::size_t(1) << INDEX_BITS;
+
+    /**
+     * @brief Heap bytes each live enemy costs (components plus its slot)
+     */
+    static constexpr std::size_t BYTES_PER_ENEMY =
+        sizeof(std::uint8_t) + sizeof(int) + 2 * sizeof(std::uint32_t) + 2 * sizeof(std::uint32_t);
+
+    /**
+     * @brief Register an enemy
+     * @param race Race of the enemy
+     * @param health Current health
+     * @param cell Cell the enemy stands on
+     * @return EnemyHandle Handle of the new enemy
+     * @throws std::length_error if the registry already holds CAPACITY enemies
+     */
+    EnemyHandle create(Race race, int health, std::size_t cell);
+
+    /**
+     * @brief Remove an enemy; its handle and all copies of it stop resolving
+     * @param handle Enemy to remove (stale handles and NONE are ignored)
+     */
+    void destroy(EnemyHandle handle);
+
+    /**
+     * @brief Add entries for enemies that are about to be placed in bulk
+     * @param count Number of entries
+     * @return std::size_t Dense index of the first new entry
+     * @throws std::length_error if the registry would exceed CAPACITY enemies
+     *
+     * Fill every new entry with place() before any other call.
+     */
+    std::size_t extend(std::size_t count);
+
+    /**
+     * @brief Fill an entry added by extend()
+     * @param index Dense index of the entry
+     * @param race Race of the enemy
+     * @param health Current health
+     * @param cell Cell the enemy stands on
+     * @return EnemyHandle Handle of the enemy
+     */
+    EnemyHandle place(std::size_t index, Race race, int health, std::size_t cell);
+
+    /**
+     * @brief Remove every enemy; all handles stop resolving
+     */
+    void clear();
+
+    /**
+     * @brief Drop every enemy together with its slot, starting over from scratch
+     *
+     * Unlike clear(), which spends a generation per enemy, this frees the
+     * slot table itself, so a registry that is emptied and refilled over
+     * and over never grows. Handles issued before the reset may name new
+     * enemies afterwards: call it only where no handle into the registry
+     * survives (see BoardOccupancy::clearAll()).
+     */
+    void reset();
+
+    /**
+     * @brief Check whether a handle names a live enemy
+     * @param handle Handle to check
+     * @return bool True if the enemy exists
+     */
+    bool contains(EnemyHandle handle) const;
+
+    /**
+     * @brief Get the number of live enemies
+     * @return std::size_t Enemy count (the length of the component arrays)
+     */
+    std::size_t size() const { return races.size(); }
+
+    /**
+     * @brief Get the dense index of a live enemy's components
+     * @param handle Live enemy
+     * @return std::size_t Index into the component arrays, valid until the next destroy()
+     */
+    std::size_t indexOf(EnemyHandle handle) const { return slots[slotOf(handle)].dense; }
+
+    /**
+     * @brief Get an enemy's race
+     * @param handle Live enemy
+     * @return Race Race of the enemy
+     */
+    Race getRace(EnemyHandle handle) const { return static_cast<Race>(races[indexOf(handle)]); }
+
+    /**
+     * @brief Get an enemy's current health
+     * @param handle Live enemy
+     * @return int Health
+     */
+    int getHealth(EnemyHandle handle) const { return healths[indexOf(handle)]; }
+
+    /**
+     * @brief Set an enemy's current health
+     * @param handle Live enemy
+     * @param health New health
+     */
+    void setHealth(EnemyHandle handle, int health) { healths[indexOf(handle)] = health; }
+
+    /**
+     * @brief Get the cell an enemy stands on
+     * @param handle Live enemy
+     * @return std::size_t Row-major cell index
+     */
+    std::size_t getCell(EnemyHandle handle) const { return cells[indexOf(handle)]; }
+
+    /**
+     * @brief Record that an enemy stands on another cell
+     * @param handle Live enemy
+     * @param cell Row-major cell index
+     */
+    void setCell(EnemyHandle handle, std::size_t cell) { cells[indexOf(handle)] = static_cast<std::uint32_t>(cell); }
+
+    /**
+     * @brief Get the race codes, one per live enemy
+     * @return const std::vector<std::uint8_t>& Packed races
+     */
+    const std::vector<std::uint8_t>& getRaces() const { return races; }
+
+    /**
+     * @brief Get the health values, one per live enemy, for in-place updates
+     * @return std::vector<int>& Packed health
+     */
+    std::vector<int>& getHealths() { return healths; }
+
+    /**
+     * @brief Get the health values, one per live enemy
+     * @return const std::vector<int>& Packed health
+     */
+    const std::vector<int>& getHealths() const { return healths; }
+
+    /**
+     * @brief Get the cells the enemies stand on, one per live enemy
+     * @return const std::vector<std::uint32_t>& Packed cells
+     */
+    const std::vector<std::uint32_t>& getCells() const { return cells; }
+
+    /**
+     * @brief Get the name every enemy of a race goes by
+     * @param race Race of the enemy
+     * @return const char* Stock enemy name
+     */
+    static const char* getName(Race race);
+
+private:
+    /**
+     * @struct Slot
+     * @brief Where a handle's enemy currently lives
+     */
+    struct Slot {
+        std::uint32_t dense;      // Index into the component arrays while live
+        std::uint32_t generation; // Current generation (never 0)
+    };
+
+    // Components, one entry per live enemy
+    std::vector<std::uint8_t> races;
+    std::vector<int> healths;
+    std::vector<std::uint32_t> cells;
+    std::vector<std::uint32_t> owners; // Slot of each entry
+
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> freeSlots;
+
+    /**
+     * @brief Take a slot for a new entry, reusing a free one if possible
+     * @param dense Dense index the slot will point at
+     * @return std::uint32_t Slot index
+     */
+    std::uint32_t takeSlot(std::uint32_t dense);
+
+    /**
+     * @brief Build the handle of a slot in its current generation
+     */
+    EnemyHandle handleOf(std::uint32_t slot) const {
+        return (slots[slot].generation << INDEX_BITS) | slot;
+    }
+
+    /**
+     * @brief Get the slot a handle selects
+     */
+    static std::uint32_t slotOf(EnemyHandle handle) {
+        return handle & ((EnemyHandle(1) << INDEX_BITS) - 1);
+    }
+};
+
+#endif // ENEMYREGISTRY_H
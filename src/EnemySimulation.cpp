@@ -0,0 +1,220 @@
+/**
+ * @file EnemySimulation.cpp
+ * @brief Implementation of EnemySimulation class
+ */
+
+#include "EnemySimulation.h"
+#include "Board.h"
+#include "JobSystem.h"
+#include "RaceTraits.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Smallest strip, in cells (a multiple of 64)
+ */
+constexpr std::size_t MIN_STRIP_CELLS = 16384;
+
+/**
+ * @brief Registry entries decided per job in pass 1
+ */
+constexpr std::size_t DECIDE_BATCH = 16384;
+
+/**
+ * @brief Ticks moving at most this many enemies apply on the calling thread
+ *
+ * Each move logs two changed cells, so such ticks fit well within the
+ * occupancy change log and Pathfinder can still repair its fields.
+ */
+constexpr std::size_t SEQUENTIAL_MOVES = BoardOccupancy::CHANGE_LOG_SIZE / 8;
+
+} // namespace
+
+EnemySimulation::EnemySimulation(Board& simulatedBoard, JobSystem& jobSystem, std::uint64_t seed)
+    : board(simulatedBoard), jobs(jobSystem), rng(seed), width(simulatedBoard.getDimensions().first),
+    cellCount(simulatedBoard.occupancy.size()) {
+    if (board.isChunked()) {
+        throw std::invalid_argument("EnemySimulation needs a dense board");
+    }
+    steps.assign(cellCount, STAY);
+
+    // A strip spans at least two rows rounded up to whole words, so the
+    // strip between two same-parity strips is wider than the one row a
+    // move can reach past either of them
+    const std::size_t rowCells = (static_cast<std::size_t>(width) + 63) / 64 * 64;
+    const std::size_t stripCells = std::max(MIN_STRIP_CELLS, 2 * rowCells);
+    for (std::size_t begin = 0; begin < cellCount; begin += stripCells) {
+        strips.push_back(Strip{begin, std::min(cellCount, begin + stripCells), {}, {}});
+    }
+}
+
+/**
+ * @brief Advance every enemy by one tick
+ *
+ * Pseudo-code:
+ * 1. Decide every enemy's step, all registry batches at once
+ * 2. Resolve the steps into moves, all strips at once
+ * 3. Apply the moves: on this thread if there are few, otherwise with the
+ *    spatial index dropped, even strips in parallel, then odd strips
+ */
+EnemySimulation::TickStats EnemySimulation::tick() {
+    const int playerX = board.getPlayerX();
+    const int playerY = board.getPlayerY();
+    const bool isDaytime = board.getIsDaytime();
+    const std::size_t playerCell = static_cast<std::size_t>(playerY) * width + playerX;
+
+    const std::size_t enemyCount = board.occupancy.getEnemies().size();
+    batchStats.assign((enemyCount + DECIDE_BATCH - 1) / DECIDE_BATCH, TickStats());
+    jobs.parallelFor(batchStats.size(), [&](std::size_t i) {
+        decide(i * DECIDE_BATCH, std::min(enemyCount, (i + 1) * DECIDE_BATCH), playerX, playerY, isDaytime,
+               batchStats[i]);
+    });
+    jobs.parallelFor(strips.size(), [&](std::size_t i) { resolve(strips[i], playerCell); });
+
+    TickStats total;
+    for (const TickStats& stats : batchStats) {
+        total.enemies += stats.enemies;
+        total.chasing += stats.chasing;
+        total.healed += stats.healed;
+    }
+    for (const Strip& strip : strips) {
+        total.moved += strip.stats.moved;
+        total.blocked += strip.stats.blocked;
+    }
+
+    if (total.moved <= SEQUENTIAL_MOVES) {
+        for (const Strip& strip : strips) {
+            apply(strip);
+        }
+    } else {
+        // The spatial index and change log are shared by the whole board;
+        // rebuild them once afterwards, as initializeBoard() does
+        board.occupancy.disableSpatialIndex();
+        for (std::size_t parity = 0; parity < 2; ++parity) {
+            jobs.parallelFor((strips.size() + 1 - parity) / 2,
+                             [&](std::size_t i) { apply(strips[2 * i + parity]); });
+        }
+        board.occupancy.enableSpatialIndex(width, board.getDimensions().second);
+    }
+
+    ++ticks;
+    return total;
+}
+
+void EnemySimulation::decide(std::size_t begin, std::size_t end, int playerX, int playerY, bool isDaytime,
+                             TickStats& stats) {
+    // Only this job touches entries [begin, end) and their cells' steps
+    EnemyRegistry& enemies = board.occupancy.getEnemies();
+    const std::vector<std::uint8_t>& races = enemies.getRaces();
+    const std::vector<std::uint32_t>& cells = enemies.getCells();
+    std::vector<int>& healths = enemies.getHealths();
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::size_t cell = cells[i];
+        const int x = static_cast<int>(cell % width);
+        const int y = static_cast<int>(cell / width);
+        const int dx = playerX - x;
+        const int dy = playerY - y;
+        const CounterRng::Block roll = rng(cell, ticks);
+        std::uint8_t step = STAY;
+        ++stats.enemies;
+
+        if (!isDaytime && std::abs(dx) + std::abs(dy) <= CHASE_RADIUS) {
+            // Close the longer gap first, tossing a coin on a diagonal;
+            // an enemy already next to the player waits for it
+            ++stats.chasing;
+            if (std::abs(dx) + std::abs(dy) > 1) {
+                const bool horizontal = std::abs(dx) > std::abs(dy) || (std::abs(dx) == std::abs(dy) && (roll[0] & 1));
+                step = horizontal ? (dx > 0 ? EAST : WEST) : (dy > 0 ? SOUTH : NORTH);
+            }
+        } else {
+            bool resting = false;
+            if (isDaytime) {
+                const int wound = RACE_TRAITS[races[i]].health - healths[i];
+                if (wound > 0) {
+                    healths[i] += std::min(wound, HEAL_PER_TICK);
+                    ++stats.healed;
+                    resting = true;
+                }
+            }
+            if (!resting && CounterRng::bounded(roll[1], isDaytime ? 4 : 2) == 0) {
+                step = static_cast<std::uint8_t>(NORTH + CounterRng::bounded(roll[2], 4));
+            }
+        }
+        steps[cell] = step;
+    }
+}
+
+void EnemySimulation::resolve(Strip& strip, std::size_t playerCell) {
+    const BoardOccupancy& occupancy = board.occupancy;
+    strip.stats = TickStats();
+    strip.moves.clear();
+    forEachEnemy(strip, [&](std::size_t cell) {
+        const std::uint8_t step = steps[cell];
+        if (step == STAY) {
+            return;
+        }
+        const std::size_t to = destination(cell, step);
+        if (to == cellCount || to == playerCell || occupancy.hasEnemy(to)) {
+            ++strip.stats.blocked;
+            return;
+        }
+
+        // Of the enemies stepping into the square, the first counting from
+        // the north, then west, east and south takes it
+        const std::size_t x = to % width;
+        const std::size_t contenders[4] = {to - width, to - 1, to + 1, to + width};
+        const bool onBoard[4] = {to >= static_cast<std::size_t>(width), x > 0, x + 1 < static_cast<std::size_t>(width),
+                                 to + width < cellCount};
+        const std::uint8_t inward[4] = {SOUTH, EAST, WEST, NORTH};
+        for (int i = 0; i < 4; ++i) {
+            const std::size_t contender = contenders[i];
+            if (onBoard[i] && occupancy.hasEnemy(contender) && steps[contender] == inward[i]) {
+                if (contender == cell) {
+                    strip.moves.push_back(Move{cell, to});
+                } else {
+                    ++strip.stats.blocked;
+                }
+                return;
+            }
+        }
+    });
+    strip.stats.moved = strip.moves.size();
+}
+
+void EnemySimulation::apply(const Strip& strip) {
+    for (const Move& move : strip.moves) {
+        board.occupancy.moveEnemy(board.squares[move.from], move.from, board.squares[move.to], move.to);
+    }
+}
+
+std::size_t EnemySimulation::destination(std::size_t cell, std::uint8_t step) const {
+    const std::size_t x = cell % width;
+    switch (step) {
+    case NORTH:
+        return cell >= static_cast<std::size_t>(width) ? cell - width : cellCount;
+    case SOUTH:
+        return cell + width < cellCount ? cell + width : cellCount;
+    case WEST:
+        return x > 0 ? cell - 1 : cellCount;
+    case EAST:
+        return x + 1 < static_cast<std::size_t>(width) ? cell + 1 : cellCount;
+    default:
+        return cell;
+    }
+}
+
+template <typename Visit>
+void EnemySimulation::forEachEnemy(const Strip& strip, Visit visit) const {
+    const std::vector<std::uint64_t>& bits = board.occupancy.getEnemyBits();
+    for (std::size_t w = strip.begin / 64; w * 64 < strip.end; ++w) {
+        std::uint64_t word = bits[w];
+        while (word) {
+            visit(w * 64 + BoardOccupancy::lowestBit(word));
+            word &= word - 1;
+        }
+    }
+}
@@ -0,0 +1,169 @@
+/**
+ * @file EnemySimulation.h
+ * @brief Optional world tick that lets the enemies on a Board wander, chase and heal
+ */
+
+#ifndef ENEMYSIMULATION_H
+#define ENEMYSIMULATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CounterRng.h"
+
+class Board;
+class JobSystem;
+
+/**
+ * @class EnemySimulation
+ * @brief Advances every enemy on a dense board by one step per tick
+ *
+ * Each tick, every enemy picks one action for the time of day:
+ * - at night, enemies within CHASE_RADIUS of the player step towards it;
+ * - by day, wounded enemies stay put and heal HEAL_PER_TICK;
+ * - any other enemy wanders to a random neighbouring square, one in two
+ *   at night and one in four by day.
+ * An enemy never steps onto the player or off the board. The tick does
+ * not advance the clock; Board::incrementCommandCount() still does.
+ *
+ * A tick runs in three passes on a JobSystem:
+ * 1. every enemy decides, from a counter-based roll keyed by (cell, tick),
+ *    in batches of the board's EnemyRegistry, whose packed components are
+ *    read and healed in place;
+ * 2. with the board cut into strips of whole rows whose edges fall on
+ *    64-cell occupancy words, moves are resolved against the board as it
+ *    was when the tick began:
+ *    the destination must have been free, and when several enemies want
+ *    the same square, the neighbour to its north wins, then west, east,
+ *    south;
+ * 3. the surviving moves are applied, even-numbered strips first and then
+ *    odd ones, so two strips writing at once are always a full strip apart
+ *    and never touch the same square or occupancy word.
+ * Passes 1 and 2 only read the board, so the outcome does not depend on
+ * the thread count or on which thread ran which strip.
+ */
+class EnemySimulation {
+public:
+    /**
+     * @brief Manhattan distance from the player within which enemies chase at night
+     */
+    static constexpr int CHASE_RADIUS = 12;
+
+    /**
+     * @brief Health a wounded enemy recovers per daytime tick
+     */
+    static constexpr int HEAL_PER_TICK = 2;
+
+    /**
+     * @struct TickStats
+     * @brief What happened during one tick
+     */
+    struct TickStats {
+        std::size_t enemies = 0; ///< Enemies on the board
+        std::size_t moved = 0;   ///< Enemies that changed square
+        std::size_t chasing = 0; ///< Enemies that tried to step towards the player
+        std::size_t healed = 0;  ///< Enemies that rested and healed
+        std::size_t blocked = 0; ///< Moves refused (edge, occupied, player or lost contest)
+    };
+
+    /**
+     * @brief Constructor for EnemySimulation
+     * @param board Dense board whose enemies to move; must outlive the simulation
+     * @param jobs Job system the passes run on
+     * @param seed Seed for the enemies' decisions
+     * @throws std::invalid_argument for chunked boards
+     */
+    EnemySimulation(Board& board, JobSystem& jobs, std::uint64_t seed);
+
+    /**
+     * @brief Advance every enemy by one tick
+     * @return TickStats Counts for this tick
+     */
+    TickStats tick();
+
+    /**
+     * @brief Get the number of ticks run so far
+     * @return std::uint64_t Ticks
+     */
+    std::uint64_t getTicks() const { return ticks; }
+
+private:
+    /**
+     * @brief Step an enemy intends to take this tick
+     */
+    enum Step : std::uint8_t {
+        STAY,
+        NORTH,
+        SOUTH,
+        WEST,
+        EAST
+    };
+
+    /**
+     * @struct Move
+     * @brief Enemy move that survived resolution
+     */
+    struct Move {
+        std::size_t from;
+        std::size_t to;
+    };
+
+    /**
+     * @struct Strip
+     * @brief Run of whole occupancy words handled as one job
+     */
+    struct Strip {
+        std::size_t begin;       ///< First cell (a multiple of 64)
+        std::size_t end;         ///< One past the last cell
+        std::vector<Move> moves; ///< Moves of this strip's enemies, rebuilt every tick
+        TickStats stats;         ///< Moved and blocked counts of pass 2
+    };
+
+    Board& board;
+    JobSystem& jobs;
+    CounterRng rng;
+    std::uint64_t ticks = 0;
+    int width;
+    std::size_t cellCount;
+    std::vector<std::uint8_t> steps; // Step per cell; meaningful only where an enemy stands
+    std::vector<Strip> strips;
+    std::vector<TickStats> batchStats; // Pass 1 counts per batch of registry entries
+
+    /**
+     * @brief Pass 1: choose a step for a batch of registry entries, healing those that rest
+     * @param begin First dense index of the batch
+     * @param end One past the last dense index
+     * @param stats Receives the batch's enemies, chasing and healed counts
+     */
+    void decide(std::size_t begin, std::size_t end, int playerX, int playerY, bool isDaytime, TickStats& stats);
+
+    /**
+     * @brief Pass 2: keep the moves of a strip that win their destination
+     * @param strip Strip whose enemies' steps to resolve
+     * @param playerCell Cell the player stands on
+     */
+    void resolve(Strip& strip, std::size_t playerCell);
+
+    /**
+     * @brief Pass 3: move the enemies of a strip
+     */
+    void apply(const Strip& strip);
+
+    /**
+     * @brief Get the cell a step leads to
+     * @param cell Starting cell
+     * @param step Step taken
+     * @return std::size_t Destination, or cellCount if the step leaves the board
+     */
+    std::size_t destination(std::size_t cell, std::uint8_t step) const;
+
+    /**
+     * @brief Visit the enemies standing in a strip, in row-major order
+     * @param strip Strip to scan
+     * @param visit Called with each enemy's cell
+     */
+    template <typename Visit>
+    void forEachEnemy(const Strip& strip, Visit visit) const;
+};
+
+#endif // ENEMYSIMULATION_H
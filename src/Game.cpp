@@ -10,63 +10,154 @@
 #include "Hobbit.h"
 #include "Orc.h"
 #include "ItemFactory.h"
-#include <iostream>
-#include <limits>
+#include "ItemCatalog.h"
+#include "CommandParser.h"
+#include "TextRenderer.h"
+#include "CommandJournal.h"
+#include "GameSnapshot.h"
+#include <cstring>
+#include <stdexcept>
+
+Game::Game() : Game(Rng::fromEntropy()()) {
+    // Seeded from std::random_device
+}
+
+Game::Game(std::uint64_t seed)
+    : rng(seed), gold(0), gameRunning(false), seed(seed), commandsExecuted(0), replayable(false) {
+    // Combat gets its own stream; the board draws its seed from ours
+    combatSystem = std::make_unique<Combat>(rng.split());
+}
 
-Game::Game() : gold(0), gameRunning(false) {
-    combatSystem = std::make_shared<Combat>();
+Game::~Game() {
+    try {
+        finishJournal();
+    } catch (const std::exception&) {
+        // Nothing can be reported from a destructor; the journal lacks its final hash
+    }
 }
 
 void Game::initializeGame(int boardWidth, int boardHeight, const std::string& playerRace, const std::string& playerName) {
     // Create game board
-    board = std::make_shared<Board>(boardWidth, boardHeight);
+    board = std::make_unique<Board>(boardWidth, boardHeight);
 
     // Create player character
     player = createPlayerCharacter(playerRace, playerName);
 
     // Initialize board with items and enemies
-    board->initializeBoard();
+    board->initializeBoard(rng);
+
+    gameRunning = true;
+    gold = 0;
+    commandsExecuted = 0;
+    replayable = true;
+}
+
+void Game::initializeGame(std::shared_ptr<const WorldFile> world, const std::string& playerRace,
+                          const std::string& playerName, std::size_t chunkMemoryBudget) {
+    // Squares come from the shared mapping; nothing is generated
+    board = std::make_unique<Board>(std::move(world), chunkMemoryBudget);
+    player = createPlayerCharacter(playerRace, playerName);
 
     gameRunning = true;
     gold = 0;
+    commandsExecuted = 0;
+    replayable = false;
+}
+
+void Game::recordTo(const std::string& path) {
+    // Replay rebuilds the start from the seed, so nothing may have happened yet
+    if (!replayable || commandsExecuted != 0 || board->getChunkedWorld()) {
+        throw std::logic_error("A journal must start right after initializeGame() on a generated board");
+    }
+
+    JournalHeader header{};
+    header.gameSeed = seed;
+    header.boardSeed = board->getSeed();
+    const auto combatState = combatSystem->getRng().getState();
+    std::copy(combatState.begin(), combatState.end(), header.combatState);
+    header.width = board->getDimensions().first;
+    header.height = board->getDimensions().second;
+    header.playerRace = static_cast<std::uint8_t>(player->getRaceId());
+    const std::string& name = player->getName();
+    header.playerNameLength = static_cast<std::uint8_t>(std::min(name.size(), sizeof(header.playerName)));
+    std::memcpy(header.playerName, name.data(), header.playerNameLength);
+
+    finishJournal();
+    journal = std::make_unique<CommandJournal>(path, header);
+}
+
+void Game::finishJournal() {
+    if (journal) {
+        journal->checkpoint(commandsExecuted, GameSnapshot::stateHash(*this));
+        journal->flush();
+        journal.reset();
+    }
 }
 
 std::string Game::processCommand(const std::string& command) {
-    if (!gameRunning) {
-        return "Game is not running. Please start a new game.";
+    return TextRenderer::render(execute(command), *this);
+}
+
+CommandResult Game::execute(std::string_view command) {
+    // Every command is journaled, even ones that change nothing, so replay
+    // sees exactly what the game saw
+    if (journal) {
+        journal->append(command);
     }
+    ++commandsExecuted;
 
-    // Convert command to lowercase for case-insensitive comparison
-    std::string lowerCommand = command;
-    for (char& c : lowerCommand) {
-        c = std::tolower(c);
+    if (!gameRunning) {
+        return CommandResult::of(CommandStatus::NotRunning, GameEvent::NotRunning);
     }
 
-    // Process different commands
-    if (lowerCommand == "north" || lowerCommand == "n") {
-        return handleMove("north");
-    } else if (lowerCommand == "south" || lowerCommand == "s") {
-        return handleMove("south");
-    } else if (lowerCommand == "east" || lowerCommand == "e") {
-        return handleMove("east");
-    } else if (lowerCommand == "west" || lowerCommand == "w") {
-        return handleMove("west");
-    } else if (lowerCommand == "pick up" || lowerCommand == "p") {
+    // Tokenize in place and resolve the verb through the perfect-hash table
+    const ParsedCommand parsed = parseCommand(command);
+    CommandResult result;
+
+    switch (parsed.verb) {
+    case Verb::North:
+        return handleMove(Verb::North);
+    case Verb::South:
+        return handleMove(Verb::South);
+    case Verb::East:
+        return handleMove(Verb::East);
+    case Verb::West:
+        return handleMove(Verb::West);
+    case Verb::PickUp:
         return handlePickUp();
-    } else if (lowerCommand == "drop" || lowerCommand == "d") {
-        return handleDrop();
-    } else if (lowerCommand == "attack" || lowerCommand == "a") {
+    case Verb::Drop:
+        return handleDrop(parsed.argument);
+    case Verb::Attack:
         return handleAttack();
-    } else if (lowerCommand == "look" || lowerCommand == "l") {
+    case Verb::Look:
         return handleLook();
-    } else if (lowerCommand == "inventory" || lowerCommand == "i") {
+    case Verb::Inventory:
         return handleInventory();
-    } else if (lowerCommand == "exit" || lowerCommand == "quit") {
+    case Verb::Quit:
         gameRunning = false;
-        return "Game ended. Total gold collected: " + std::to_string(gold);
-    } else {
-        return "Unknown command. Available commands: north, south, east, west, pick up, drop, attack, look, inventory, exit";
+        result = CommandResult::of(CommandStatus::Ok, GameEvent::GameEnded, 0, gold);
+        result.gameOver = true;
+        return result;
+    case Verb::Unknown:
+        break;
     }
+    return CommandResult::of(CommandStatus::Unknown, GameEvent::UnknownCommand);
+}
+
+const Board& Game::getBoard() const {
+    return *board;
+}
+
+const Character& Game::getPlayer() const {
+    return *player;
+}
+
+int Game::getGold() const {
+    return gold;
+}
+
+std::uint64_t Game::getSeed() const {
+    return seed;
 }
 
 bool Game::isGameRunning() const {
@@ -83,55 +174,54 @@ std::string Game::getGameStatus() const {
     return status;
 }
 
-std::string Game::handleMove(const std::string& direction) {
-    bool moved = board->movePlayer(direction);
+CommandResult Game::handleMove(Verb direction) {
+    bool moved = board->movePlayer(std::string(verbName(direction)));
+    const std::uint8_t subject = static_cast<std::uint8_t>(direction);
 
     if (moved) {
-        return "Moved " + direction + ". " + board->getCurrentLocationDescription();
+        return CommandResult::of(CommandStatus::Ok, GameEvent::Moved, subject);
     } else {
-        return "Cannot move " + direction + " - out of bounds.";
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::OutOfBounds, subject);
     }
 }
 
-std::string Game::handlePickUp() {
-    std::shared_ptr<Square> currentSquare = board->getSquare(board->getPlayerX(), board->getPlayerY());
+CommandResult Game::handlePickUp() {
+    const Square* currentSquare = board->getSquare(board->getPlayerX(), board->getPlayerY());
 
-    if (!currentSquare->getItem()) {
-        return "No item here to pick up.";
+    const ItemId item = currentSquare->getItemId();
+    if (item == ItemCatalog::NONE) {
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::NoItemHere);
     }
 
-    std::shared_ptr<Item> item = currentSquare->getItem();
-
     // Check if player can carry the item
     if (player->getInventory().addItem(item)) {
-        currentSquare->removeItem();
-        return "Picked up: " + item->getName();
+        board->removeItem(board->getPlayerX(), board->getPlayerY());
+        return CommandResult::of(CommandStatus::Ok, GameEvent::PickedUp, item);
     } else {
-        return "Cannot pick up " + item->getName() + " - too heavy or category limit reached.";
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::TooHeavy, item);
     }
 }
 
 /**
- * @brief Handle drop command with user prompting
- * @return std::string Result message
+ * @brief Handle drop command
+ * @param argument Item number (1-based, 0 cancels) or item name; empty to list choices
+ * @return CommandResult Result of the drop
  *
  * Pseudo-code:
  * 1. Check if current square already has an item
- * 2. If square has item, return error message
- * 3. Display player's inventory with numbered list
- * 4. Prompt user to select item by number
- * 5. Validate user input
- * 6. Get the selected item's name
- * 7. Remove item from inventory by name using existing method
- * 8. Place actual item on current square
- * 9. Return success message
+ * 2. If square has item, reject
+ * 3. If no argument, ask the client to choose from the inventory
+ * 4. Resolve the argument to an inventory slot by number or by name
+ * 5. Remove item from inventory by name using existing method
+ * 6. Place actual item on current square
+ * 7. Return the dropped item id
  */
-std::string Game::handleDrop() {
-    std::shared_ptr<Square> currentSquare = board->getSquare(board->getPlayerX(), board->getPlayerY());
+CommandResult Game::handleDrop(std::string_view argument) {
+    const Square* currentSquare = board->getSquare(board->getPlayerX(), board->getPlayerY());
 
     // Check if square already has an item
     if (currentSquare->getItem()) {
-        return "Cannot drop item here - square already contains an item.";
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::SquareOccupied);
     }
 
     // Get player's inventory
@@ -140,196 +230,151 @@ std::string Game::handleDrop() {
 
     // Check if inventory is empty
     if (items.empty()) {
-        return "Your inventory is empty - nothing to drop.";
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::InventoryEmpty);
     }
 
-    // Display inventory with numbers
-    std::cout << "\nYour inventory:\n";
-    for (size_t i = 0; i < items.size(); ++i) {
-        std::cout << "  " << (i + 1) << ". " << items[i]->getDescription() << "\n";
-    }
-
-    // Prompt user for item selection
-    int choice;
-    std::cout << "\nWhich item do you want to drop? (enter number, or 0 to cancel): ";
-    std::cin >> choice;
-
-    // Validate input
-    if (std::cin.fail()) {
-        std::cin.clear();
-        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        return "Invalid input - please enter a number.";
+    // No argument: the client lists the inventory and asks
+    if (argument.empty()) {
+        return CommandResult::of(CommandStatus::NeedsChoice, GameEvent::DropChoices, 0,
+                                 static_cast<std::int32_t>(items.size()));
     }
-    std::cin.ignore(); // Clear newline
 
-    // Check for cancel
-    if (choice == 0) {
-        return "Drop cancelled.";
+    int itemIndex = findInventorySlot(argument);
+    if (itemIndex == DROP_CANCELLED) {
+        return CommandResult::of(CommandStatus::Ok, GameEvent::DropCancelled);
     }
-
-    // Validate choice range
-    if (choice < 1 || choice > static_cast<int>(items.size())) {
-        return "Invalid choice - please select a number from the list.";
+    if (itemIndex < 0) {
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::InvalidChoice);
     }
 
-    // Get the selected item's name (adjust for 0-based index)
-    int itemIndex = choice - 1;
-    std::string itemName = items[itemIndex]->getName();
+    // Get the selected item's name
+    const ItemId itemId = items[itemIndex];
+    std::string itemName(ItemCatalog::getEntry(itemId).name);
 
     // Remove item from inventory by name using existing method
     if (inventory.removeItem(itemName)) {
         // Recreate the item for the square
         std::shared_ptr<Item> droppedItem = recreateItemByName(itemName);
         if (droppedItem) {
-            currentSquare->setItem(droppedItem);
-            return "Dropped: " + itemName;
-        } else {
-            return "Failed to create item for dropping.";
+            board->setItem(board->getPlayerX(), board->getPlayerY(), droppedItem->getTypeId());
+            return CommandResult::of(CommandStatus::Ok, GameEvent::Dropped, itemId);
         }
-    } else {
-        return "Failed to drop item from inventory.";
     }
+    return CommandResult::of(CommandStatus::Rejected, GameEvent::DropFailed);
+}
+
+int Game::findInventorySlot(std::string_view argument) {
+    const auto& items = player->getInventory().getItems();
+
+    // A number selects by position in the inventory listing
+    bool numeric = !argument.empty() && argument.find_first_not_of("0123456789") == std::string_view::npos;
+    if (numeric) {
+        if (argument.size() > 3) return -1;
+        int choice = 0;
+        for (char c : argument) {
+            choice = choice * 10 + (c - '0');
+        }
+        if (choice == 0) return DROP_CANCELLED;
+        return choice <= static_cast<int>(items.size()) ? choice - 1 : -1;
+    }
+
+    // Otherwise match an item name, ignoring case
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (equalsIgnoreCase(ItemCatalog::getEntry(items[i]).name, argument)) return static_cast<int>(i);
+    }
+    return -1;
 }
 
 /**
  * @brief Recreate an item by its name (helper function for drop)
  * @param itemName Name of the item to recreate
- * @return std::shared_ptr<Item> Recreated item or nullptr if not found
+ * @return std::shared_ptr<Item> Shared catalog item or nullptr if not found
  *
  * Pseudo-code:
- * 1. Check item name against all known item types
- * 2. Use ItemFactory to create the appropriate item
- * 3. Return the created item
+ * 1. Look the name up in the item catalog table
+ * 2. Return the shared catalog instance for that item type
  */
 std::shared_ptr<Item> Game::recreateItemByName(const std::string& itemName) {
-    if (itemName == "Sword") {
-        return ItemFactory::createSword();
-    } else if (itemName == "Dagger") {
-        return ItemFactory::createDagger();
-    } else if (itemName == "Plate Armour") {
-        return ItemFactory::createPlateArmour();
-    } else if (itemName == "Leather Armour") {
-        return ItemFactory::createLeatherArmour();
-    } else if (itemName == "Large Shield") {
-        return ItemFactory::createLargeShield();
-    } else if (itemName == "Small Shield") {
-        return ItemFactory::createSmallShield();
-    } else if (itemName == "Ring of Life") {
-        return ItemFactory::createRingOfLife();
-    } else if (itemName == "Ring of Strength") {
-        return ItemFactory::createRingOfStrength();
-    }
-    return nullptr;
+    return ItemCatalog::share(ItemCatalog::findByName(itemName));
 }
 
-std::string Game::handleAttack() {
-    std::shared_ptr<Square> currentSquare = board->getSquare(board->getPlayerX(), board->getPlayerY());
-    std::shared_ptr<Character> enemy = currentSquare->getEnemy();
-
-    if (!enemy) {
-        return "No enemy here to attack.";
+CommandResult Game::handleAttack() {
+    const int x = board->getPlayerX();
+    const int y = board->getPlayerY();
+    if (!board->getSquare(x, y)->hasEnemy()) {
+        return CommandResult::of(CommandStatus::Rejected, GameEvent::NoEnemy);
     }
 
-    std::string message = "COMBAT BEGINS!\n\n";
+    // The board keeps only the enemy's race and health: fight a stock
+    // character of that race carrying the same health, then store it back
+    const Race race = board->getEnemyRace(x, y);
+    const std::unique_ptr<Character> enemy = Board::createEnemy(race);
+    enemy->takeDamage(enemy->getHealth() - board->getEnemyHealth(x, y));
+
+    const std::uint8_t enemyRace = static_cast<std::uint8_t>(race);
+    CommandResult result = CommandResult::of(CommandStatus::Ok, GameEvent::CombatStarted);
 
     // PHASE 1: Player attacks enemy (Rule: player attacks first)
-    message += "YOUR ATTACK:\n";
-    auto playerAttackResult = combatSystem->executeCombatRound(player, enemy, board->getIsDaytime());
+    auto playerAttackResult = combatSystem->executeCombatRound(*player, *enemy, board->getIsDaytime());
+
+    if (playerAttackResult.first && enemy->isDefeated()) {
+        // Enemy defeated by player's attack - no counterattack
+        result.add(GameEvent::EnemyDefeated, enemyRace, playerAttackResult.second);
+        gold += playerAttackResult.second;
+        board->removeEnemy(x, y);
+        return result;
+    }
 
     if (playerAttackResult.first) {
-        // Player's attack was successful
-        if (enemy->isDefeated()) {
-            // Enemy defeated by player's attack - no counterattack
-            message += "You defeated the " + enemy->getRace() + "!\n";
-            message += "Gained " + std::to_string(playerAttackResult.second) + " gold.\n";
-            gold += playerAttackResult.second;
-            currentSquare->removeEnemy();
-        } else {
-            // Enemy survived player's attack
-            message += "You hit the " + enemy->getRace() + "!\n";
-            message += "Enemy health: " + std::to_string(enemy->getHealth()) + "\n\n";
-
-            // PHASE 2: Enemy counterattacks (Rule: enemy counterattacks unless defeated)
-            message += "ENEMY COUNTERATTACK:\n";
-            auto enemyAttackResult = combatSystem->executeCombatRound(enemy, player, board->getIsDaytime());
-
-            if (enemyAttackResult.first) {
-                // Enemy's counterattack was successful
-                message += "The " + enemy->getRace() + " hits you!\n";
-                message += "Your health: " + std::to_string(player->getHealth()) + "\n";
-
-                // Check if player was defeated by counterattack
-                if (player->isDefeated()) {
-                    message += "\nYOU HAVE BEEN DEFEATED! GAME OVER.\n";
-                    gameRunning = false;
-                }
-            } else {
-                // Enemy's counterattack missed
-                message += "The " + enemy->getRace() + "'s attack missed!\n";
-            }
-        }
+        // Enemy survived player's attack
+        result.add(GameEvent::PlayerHit, enemyRace, enemy->getHealth());
     } else {
-        // Player's attack missed
-        message += "Your attack missed!\n\n";
-
-        // PHASE 2: Enemy counterattacks even if player missed (Rule: enemy always counterattacks unless defeated)
-        message += "ENEMY COUNTERATTACK:\n";
-        auto enemyAttackResult = combatSystem->executeCombatRound(enemy, player, board->getIsDaytime());
-
-        if (enemyAttackResult.first) {
-            // Enemy's counterattack was successful
-            message += "The " + enemy->getRace() + " hits you!\n";
-            message += "Your health: " + std::to_string(player->getHealth()) + "\n";
-
-            // Check if player was defeated by counterattack
-            if (player->isDefeated()) {
-                message += "\nYOU HAVE BEEN DEFEATED! GAME OVER.\n";
-                gameRunning = false;
-            }
-        } else {
-            // Enemy's counterattack missed
-            message += "The " + enemy->getRace() + "'s attack missed!\n";
+        result.add(GameEvent::PlayerMissed);
+    }
+
+    // PHASE 2: Enemy counterattacks (Rule: enemy always counterattacks unless defeated)
+    auto enemyAttackResult = combatSystem->executeCombatRound(*enemy, *player, board->getIsDaytime());
+    board->setEnemyHealth(x, y, enemy->getHealth());
+
+    if (enemyAttackResult.first) {
+        // Enemy's counterattack was successful
+        result.add(GameEvent::EnemyHit, enemyRace, player->getHealth());
+
+        // Check if player was defeated by counterattack
+        if (player->isDefeated()) {
+            result.add(GameEvent::PlayerDefeated);
+            gameRunning = false;
+            result.gameOver = true;
         }
+    } else {
+        // Enemy's counterattack missed
+        result.add(GameEvent::EnemyMissed, enemyRace);
     }
 
-    return message;
+    return result;
 }
 
-std::string Game::handleLook() {
-    return board->getCurrentLocationDescription();
+CommandResult Game::handleLook() {
+    return CommandResult::of(CommandStatus::Ok, GameEvent::LocationShown);
 }
 
-/**
- * @brief Handle inventory command - shows items and gold
- * @return std::string Inventory summary with gold
- *
- * Pseudo-code:
- * 1. Get inventory summary from player's inventory
- * 2. Add gold information to the summary
- * 3. Return combined inventory and gold display
- */
-std::string Game::handleInventory() {
-    std::string inventorySummary = player->getInventory().getInventorySummary();
-
-    // Add gold information to the inventory display
-    std::string goldInfo = "\nGold: " + std::to_string(gold);
-
-    return inventorySummary + goldInfo;
+CommandResult Game::handleInventory() {
+    return CommandResult::of(CommandStatus::Ok, GameEvent::InventoryShown, 0, gold);
 }
 
-std::shared_ptr<Character> Game::createPlayerCharacter(const std::string& race, const std::string& name) {
+std::unique_ptr<Character> Game::createPlayerCharacter(const std::string& race, const std::string& name) {
     if (race == "human") {
-        return std::make_shared<Human>(name);
+        return std::make_unique<Human>(name);
     } else if (race == "elf") {
-        return std::make_shared<Elf>(name);
+        return std::make_unique<Elf>(name);
     } else if (race == "dwarf") {
-        return std::make_shared<Dwarf>(name);
+        return std::make_unique<Dwarf>(name);
     } else if (race == "hobbit") {
-        return std::make_shared<Hobbit>(name);
+        return std::make_unique<Hobbit>(name);
     } else if (race == "orc") {
-        return std::make_shared<Orc>(name);
+        return std::make_unique<Orc>(name);
     } else {
         // Default to human if race not recognized
-        return std::make_shared<Human>(name);
+        return std::make_unique<Human>(name);
     }
 }
@@ -7,9 +7,15 @@
 #define GAME_H
 
 #include <memory>
+#include <string_view>
 #include "Board.h"
 #include "Character.h"
 #include "Combat.h"
+#include "Rng.h"
+#include "CommandResult.h"
+#include "CommandParser.h"
+
+class CommandJournal;
 
 /**
  * @class Game
@@ -20,18 +26,39 @@
  */
 class Game {
 private:
-    std::shared_ptr<Board> board;
-    std::shared_ptr<Character> player;
-    std::shared_ptr<Combat> combatSystem;
+    std::unique_ptr<Board> board;
+    std::unique_ptr<Character> player;
+    std::unique_ptr<Combat> combatSystem;
+    Rng rng;
     int gold;
     bool gameRunning;
+    std::uint64_t seed;               ///< Seed the game was constructed with
+    std::uint64_t commandsExecuted;   ///< Commands since initializeGame()
+    bool replayable;                  ///< Started by initializeGame() on a generated board
+    std::unique_ptr<CommandJournal> journal;
+
+    friend class GameSnapshot;   // Saves and restores the fields above
+    friend class CommandJournal; // Checks the generator states on replay
 
 public:
     /**
-     * @brief Constructor for Game
+     * @brief Constructor for Game with a non-reproducible random stream
      */
     Game();
 
+    /**
+     * @brief Constructor for a reproducible Game
+     * @param seed Seed for every random decision (board layout and combat rolls)
+     *
+     * Games share no random state, so any number can run in parallel.
+     */
+    explicit Game(std::uint64_t seed);
+
+    /**
+     * @brief Destructor - finishes the command journal, if any
+     */
+    ~Game();
+
     /**
      * @brief Initialize a new game
      * @param boardWidth Width of game board
@@ -42,12 +69,62 @@ public:
     void initializeGame(int boardWidth, int boardHeight, const std::string& playerRace, const std::string& playerName);
 
     /**
-     * @brief Process a game command
+     * @brief Initialize a new game on a pre-built world
+     * @param world Mapped world file; many games can share one
+     * @param playerRace Race of the player character
+     * @param playerName Name of the player character
+     * @param chunkMemoryBudget Bytes of squares this game keeps resident
+     *
+     * Starts in constant time regardless of the world's size. The player
+     * starts where the file says; changes stay in this game.
+     */
+    void initializeGame(std::shared_ptr<const WorldFile> world, const std::string& playerRace,
+                        const std::string& playerName, std::size_t chunkMemoryBudget = WORLD_CHUNK_BUDGET);
+
+    /**
+     * @brief Default resident square budget for games on a world file
+     */
+    static constexpr std::size_t WORLD_CHUNK_BUDGET = 8u << 20;
+
+    /**
+     * @brief Record every following command to a journal file
+     * @param path Journal file to create or replace
+     * @throws std::logic_error unless called right after initializeGame() on a generated board
+     * @throws std::runtime_error if the file cannot be created
+     *
+     * The journal holds the seeds, board size and player, then each
+     * command passed to execute() or processCommand(). Records are
+     * buffered and written in batches; finishJournal() or the destructor
+     * adds a final state hash. CommandJournal::replay() re-executes it.
+     */
+    void recordTo(const std::string& path);
+
+    /**
+     * @brief Write the final state hash and close the journal
+     *
+     * Does nothing when no journal is being recorded.
+     */
+    void finishJournal();
+
+    /**
+     * @brief Process a game command and render the result as text
      * @param command The command string from player
      * @return std::string Result message
      */
     std::string processCommand(const std::string& command);
 
+    /**
+     * @brief Execute a game command without any console I/O
+     * @param command Command line, e.g. "north", "attack", "drop 2", "drop ring of life"
+     * @return CommandResult Status, event codes and whether the game ended
+     *
+     * Parsing is allocation-free (see CommandParser.h) and the result
+     * holds no text; pass it to TextRenderer::render() for display.
+     * Never blocks: commands that need a choice (a bare "drop") return
+     * NeedsChoice instead of prompting.
+     */
+    CommandResult execute(std::string_view command);
+
     /**
      * @brief Check if game is still running
      * @return bool True if game is active
@@ -60,56 +137,93 @@ public:
      */
     std::string getGameStatus() const;
 
+    /**
+     * @brief Get the game board (valid after initializeGame())
+     * @return const Board& Board
+     */
+    const Board& getBoard() const;
+
+    /**
+     * @brief Get the player character (valid after initializeGame())
+     * @return const Character& Player
+     */
+    const Character& getPlayer() const;
+
+    /**
+     * @brief Get the gold collected so far
+     * @return int Gold
+     */
+    int getGold() const;
+
+    /**
+     * @brief Get the seed the game was constructed with
+     * @return std::uint64_t Seed (drawn from std::random_device for Game())
+     */
+    std::uint64_t getSeed() const;
+
 private:
     /**
      * @brief Handle player movement command
-     * @param direction Movement direction
-     * @return std::string Result message
+     * @param direction Verb::North, South, East or West
+     * @return CommandResult Moved or OutOfBounds
      */
-    std::string handleMove(const std::string& direction);
+    CommandResult handleMove(Verb direction);
 
     /**
      * @brief Handle pick up item command
-     * @return std::string Result message
+     * @return CommandResult Result message
      */
-    std::string handlePickUp();
+    CommandResult handlePickUp();
 
     /**
-     * @brief Handle drop item command with user prompting
-     * @return std::string Result message
+     * @brief Handle drop item command
+     * @param argument Item number, item name, or empty to list the choices
+     * @return CommandResult Result message
+     */
+    CommandResult handleDrop(std::string_view argument);
+
+    /**
+     * @brief Resolve a drop argument to an inventory slot
+     * @param argument Item number (1-based) or item name in any case
+     * @return int Slot index, DROP_CANCELLED for "0", or -1 if nothing matches
      */
-    std::string handleDrop();
+    int findInventorySlot(std::string_view argument);
+
+    /**
+     * @brief findInventorySlot() result for "drop 0"
+     */
+    static constexpr int DROP_CANCELLED = -2;
 
     /**
      * @brief Handle attack command
-     * @return std::string Result message
+     * @return CommandResult Result message
      */
-    std::string handleAttack();
+    CommandResult handleAttack();
 
     /**
      * @brief Handle look command
-     * @return std::string Result message
+     * @return CommandResult Result message
      */
-    std::string handleLook();
+    CommandResult handleLook();
 
     /**
      * @brief Handle inventory command
-     * @return std::string Result message
+     * @return CommandResult Result message
      */
-    std::string handleInventory();
+    CommandResult handleInventory();
 
     /**
      * @brief Create player character based on race
      * @param race Race name
      * @param name Character name
-     * @return std::shared_ptr<Character> Player character
+     * @return std::unique_ptr<Character> Player character
      */
-    std::shared_ptr<Character> createPlayerCharacter(const std::string& race, const std::string& name);
+    std::unique_ptr<Character> createPlayerCharacter(const std::string& race, const std::string& name);
 
     /**
      * @brief Recreate an item by its name for dropping
      * @param itemName Name of the item to recreate
-     * @return std::shared_ptr<Item> Recreated item
+     * @return std::shared_ptr<Item> Shared catalog item, or nullptr for an unknown name
      */
     std::shared_ptr<Item> recreateItemByName(const std::string& itemName);
 };
@@ -0,0 +1,263 @@
+/**
+ * @file GameSnapshot.cpp
+ * @brief Implementation of GameSnapshot class
+ */
+
+#include "GameSnapshot.h"
+#include "Game.h"
+#include "RaceTraits.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <streambuf>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_trivially_copyable<SnapshotHeader>::value, "header is copied as raw bytes");
+static_assert(sizeof(SnapshotHeader) % 8 == 0, "header keeps the sections behind it aligned");
+static_assert(sizeof(CellRecord) == 4, "cells are stored as 4-byte records");
+
+namespace {
+
+constexpr char MAGIC[8] = {'S', 'O', 'M', 'E', 'S', 'N', 'A', 'P'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::size_t CELL_BLOCK = 1 << 16; // Records per write call
+
+std::uint64_t alignTo8(std::uint64_t offset) {
+    return (offset + 7) & ~std::uint64_t(7);
+}
+
+/**
+ * @class HashingBuffer
+ * @brief Output stream buffer that folds every byte into an FNV-1a hash
+ */
+class HashingBuffer : public std::streambuf {
+public:
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            add(static_cast<unsigned char>(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize count) override {
+        for (std::streamsize i = 0; i < count; ++i) {
+            add(static_cast<unsigned char>(data[i]));
+        }
+        return count;
+    }
+
+private:
+    void add(unsigned char byte) {
+        hash = (hash ^ byte) * 0x100000001B3ULL;
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Write a game to a stream
+ * @param game Game to save
+ * @param out Binary output stream
+ *
+ * Pseudo-code:
+ * 1. Fill the header from the game, board, player and both generators
+ * 2. Write the header and the player's item ids
+ * 3. Encode the grid block by block into CellRecords and write each block
+ */
+void GameSnapshot::save(const Game& game, std::ostream& out) {
+    const Board& board = *game.board;
+    const Character& player = *game.player;
+    if (board.world) {
+        throw std::runtime_error("Chunked boards cannot be saved");
+    }
+
+    const std::vector<ItemId>& items = player.getInventory().getItems();
+    const std::string& name = player.getName();
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.width = board.width;
+    header.height = board.height;
+    header.playerX = board.playerX;
+    header.playerY = board.playerY;
+    header.commandCount = board.commandCount;
+    header.gold = game.gold;
+    header.boardSeed = board.boardSeed;
+    const auto gameState = game.rng.getState();
+    const auto combatState = game.combatSystem->getRng().getState();
+    std::copy(gameState.begin(), gameState.end(), header.gameRng);
+    std::copy(combatState.begin(), combatState.end(), header.combatRng);
+    header.isDaytime = board.isDaytime ? 1 : 0;
+    header.gameRunning = game.gameRunning ? 1 : 0;
+    header.playerRace = static_cast<std::uint8_t>(player.getRaceId());
+    header.playerNameLength = static_cast<std::uint8_t>(std::min(name.size(), sizeof(header.playerName)));
+    std::memcpy(header.playerName, name.data(), header.playerNameLength);
+    header.playerHealth = player.getHealth() - player.getInventory().getTotalModifications().health;
+    header.itemCount = static_cast<std::uint32_t>(items.size());
+    header.itemsOffset = sizeof(SnapshotHeader);
+    header.cellsOffset = alignTo8(header.itemsOffset + items.size());
+    header.fileBytes = header.cellsOffset + board.squares.size() * sizeof(CellRecord);
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::vector<char> itemBytes(header.cellsOffset - header.itemsOffset, 0);
+    std::copy(items.begin(), items.end(), itemBytes.begin());
+    out.write(itemBytes.data(), static_cast<std::streamsize>(itemBytes.size()));
+
+    // Single pass over the grid, one block of records per write
+    std::vector<CellRecord> block(std::min(CELL_BLOCK, board.squares.size()));
+    for (std::size_t start = 0; start < board.squares.size(); start += block.size()) {
+        const std::size_t count = std::min(block.size(), board.squares.size() - start);
+        for (std::size_t i = 0; i < count; ++i) {
+            block[i] = CellRecord::fromSquare(board.squares[start + i], board.occupancy.getEnemies());
+        }
+        out.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(count * sizeof(CellRecord)));
+    }
+
+    if (!out) {
+        throw std::runtime_error("Failed to write game snapshot");
+    }
+}
+
+void GameSnapshot::save(const Game& game, const std::string& path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    save(game, out);
+}
+
+std::uint64_t GameSnapshot::stateHash(const Game& game) {
+    HashingBuffer buffer;
+    std::ostream out(&buffer);
+    save(game, out);
+    return buffer.hash;
+}
+
+void GameSnapshot::checkHeader(const SnapshotHeader& header) {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a game snapshot");
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(header.version));
+    }
+    if (header.byteOrder != BYTE_ORDER_MARK) {
+        throw std::runtime_error("Snapshot was written with a different byte order");
+    }
+
+    const std::uint64_t cellCount = static_cast<std::uint64_t>(std::max(header.width, 0)) *
+                                    static_cast<std::uint64_t>(std::max(header.height, 0));
+    if (header.width <= 0 || header.height <= 0 || header.playerRace >= RACE_COUNT ||
+        header.playerNameLength > sizeof(header.playerName) ||
+        header.itemsOffset != sizeof(SnapshotHeader) ||
+        header.cellsOffset != alignTo8(header.itemsOffset + header.itemCount) ||
+        header.fileBytes != header.cellsOffset + cellCount * sizeof(CellRecord) ||
+        header.playerX < 0 || header.playerX >= header.width ||
+        header.playerY < 0 || header.playerY >= header.height) {
+        throw std::runtime_error("Snapshot header is inconsistent");
+    }
+}
+
+/**
+ * @brief Read a game from a stream
+ * @param in Binary input stream
+ * @param threads Threads applying cells (0 = hardware concurrency)
+ * @return std::unique_ptr<Game> Restored game
+ *
+ * Pseudo-code:
+ * 1. Read and validate the header (magic, version, byte order, sizes)
+ * 2. Rebuild the player from race, name, health and item ids
+ * 3. Read the cell array in one call, then apply only the non-empty
+ *    cells to a fresh board, split across threads
+ * 4. Restore positions, counters, gold and both generator states
+ */
+std::unique_ptr<Game> GameSnapshot::load(std::istream& in, unsigned int threads) {
+    SnapshotHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Snapshot is truncated");
+    }
+    checkHeader(header);
+    const std::uint64_t cellCount = static_cast<std::uint64_t>(header.width) * static_cast<std::uint64_t>(header.height);
+
+    std::vector<char> itemBytes(header.cellsOffset - header.itemsOffset);
+    if (!in.read(itemBytes.data(), static_cast<std::streamsize>(itemBytes.size()))) {
+        throw std::runtime_error("Snapshot is truncated");
+    }
+
+    auto game = std::make_unique<Game>(0);
+
+    // Player: fresh character of the saved race, then health and items
+    std::string race = raceTraits(static_cast<Race>(header.playerRace)).name;
+    std::transform(race.begin(), race.end(), race.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    game->player = game->createPlayerCharacter(race, std::string(header.playerName, header.playerNameLength));
+    game->player->takeDamage(game->player->getHealth() - header.playerHealth);
+    for (std::uint32_t i = 0; i < header.itemCount; ++i) {
+        const ItemId item = static_cast<ItemId>(itemBytes[i]);
+        if (!ItemCatalog::isValid(item) || !game->player->getInventory().addItem(item)) {
+            throw std::runtime_error("Snapshot inventory is invalid");
+        }
+    }
+
+    // Cells: one read straight into the record array
+    std::vector<CellRecord> cells(static_cast<std::size_t>(cellCount));
+    if (!in.read(reinterpret_cast<char*>(cells.data()), static_cast<std::streamsize>(cellCount * sizeof(CellRecord)))) {
+        throw std::runtime_error("Snapshot is truncated");
+    }
+    for (const CellRecord& record : cells) {
+        if (!record.isValid()) {
+            throw std::runtime_error("Snapshot contains an invalid cell");
+        }
+    }
+
+    // Board: squares start empty, so only occupied cells need work.
+    // Board::fillGrid() splits the cells between threads as
+    // Board::initializeBoard() does and registers the enemies in bulk.
+    auto board = std::make_unique<Board>(header.width, header.height);
+    board->fillGrid(threads, [&cells, &board](std::size_t begin, std::size_t end,
+                                              std::vector<Board::PendingEnemy>& enemies) {
+        for (std::size_t cell = begin; cell < end; ++cell) {
+            const CellRecord& record = cells[cell];
+            if (record.itemType != BoardOccupancy::NONE) {
+                board->occupancy.setItem(board->squares[cell], cell, static_cast<ItemId>(record.itemType));
+            }
+            if (record.enemyRace != BoardOccupancy::NONE) {
+                enemies.push_back(Board::PendingEnemy{static_cast<std::uint32_t>(cell), record});
+            }
+        }
+    });
+
+    board->playerX = header.playerX;
+    board->playerY = header.playerY;
+    board->isDaytime = header.isDaytime != 0;
+    board->commandCount = header.commandCount;
+    board->boardSeed = header.boardSeed;
+
+    std::array<std::uint64_t, 4> gameState;
+    std::array<std::uint64_t, 4> combatState;
+    std::copy(std::begin(header.gameRng), std::end(header.gameRng), gameState.begin());
+    std::copy(std::begin(header.combatRng), std::end(header.combatRng), combatState.begin());
+
+    game->board = std::move(board);
+    game->rng = Rng::fromState(gameState);
+    game->combatSystem = std::make_unique<Combat>(Rng::fromState(combatState));
+    game->gold = header.gold;
+    game->gameRunning = header.gameRunning != 0;
+    return game;
+}
+
+std::unique_ptr<Game> GameSnapshot::load(const std::string& path, unsigned int threads) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    return load(in, threads);
+}
@@ -0,0 +1,123 @@
+/**
+ * @file GameSnapshot.h
+ * @brief Versioned binary save/load of a complete game
+ */
+
+#ifndef GAMESNAPSHOT_H
+#define GAMESNAPSHOT_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include "CellRecord.h"
+
+class Game;
+
+/**
+ * @struct SnapshotHeader
+ * @brief Fixed-size header at the start of every snapshot file
+ *
+ * All fields are fixed-width and naturally aligned, so the header and the
+ * cell array behind it can be read (or mapped) straight into memory.
+ * Numbers are stored in the writer's byte order; byteOrder lets a reader
+ * reject a file from a machine with the other order.
+ */
+struct SnapshotHeader {
+    char magic[8];               ///< "SOMESNAP"
+    std::uint32_t version;       ///< GameSnapshot::VERSION
+    std::uint32_t byteOrder;     ///< 0x01020304 as written
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t playerX;
+    std::int32_t playerY;
+    std::int32_t commandCount;   ///< Day/night counter
+    std::int32_t gold;
+    std::uint64_t boardSeed;
+    std::uint64_t gameRng[4];    ///< Game's generator state
+    std::uint64_t combatRng[4];  ///< Combat system's generator state
+    std::uint8_t isDaytime;
+    std::uint8_t gameRunning;
+    std::uint8_t playerRace;     ///< Race code
+    std::uint8_t playerNameLength;
+    std::int32_t playerHealth;   ///< Health without item modifiers
+    char playerName[64];         ///< Not NUL-terminated; longer names are cut
+    std::uint32_t itemCount;     ///< Player inventory size
+    std::uint32_t reserved;
+    std::uint64_t itemsOffset;   ///< File offset of itemCount item ids
+    std::uint64_t cellsOffset;   ///< File offset of width * height CellRecords
+    std::uint64_t fileBytes;     ///< Total file size
+};
+
+/**
+ * @class GameSnapshot
+ * @brief Writes and reads a whole game as one flat binary image
+ *
+ * Layout: SnapshotHeader, the player's item ids, padding to 8 bytes, then
+ * one 4-byte CellRecord per square in row-major order. Saving streams the
+ * grid in a single pass; loading reads the whole cell array with one call
+ * and only touches squares that hold something, on several threads.
+ * Generator states are saved exactly, so a loaded game plays on
+ * identically to the original.
+ *
+ * Chunked boards are not supported (their chunks live in ChunkedWorld).
+ */
+class GameSnapshot {
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * @brief Write a game to a stream
+     * @param game Game to save (must have been initialized)
+     * @param out Binary output stream
+     * @throws std::runtime_error for chunked boards or write errors
+     */
+    static void save(const Game& game, std::ostream& out);
+
+    /**
+     * @brief Write a game to a file
+     * @param game Game to save
+     * @param path File to create or replace
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void save(const Game& game, const std::string& path);
+
+    /**
+     * @brief Hash everything a snapshot would save
+     * @param game Game to hash (dense board)
+     * @return std::uint64_t FNV-1a hash of the snapshot bytes
+     * @throws std::runtime_error for chunked boards
+     *
+     * Equal hashes mean equal board, player, counters and generator
+     * states. Nothing is written or allocated beyond save()'s buffers.
+     */
+    static std::uint64_t stateHash(const Game& game);
+
+    /**
+     * @brief Validate a header read from a file
+     * @param header Header to check
+     * @throws std::runtime_error on a wrong magic, version or byte order,
+     *         or sizes and offsets that do not fit together
+     */
+    static void checkHeader(const SnapshotHeader& header);
+
+    /**
+     * @brief Read a game from a stream
+     * @param in Binary input stream positioned at a snapshot
+     * @param threads Threads rebuilding the squares (0 = hardware concurrency)
+     * @return std::unique_ptr<Game> Restored game
+     * @throws std::runtime_error if the data is not a valid snapshot of this version
+     */
+    static std::unique_ptr<Game> load(std::istream& in, unsigned int threads = 0);
+
+    /**
+     * @brief Read a game from a file
+     * @param path Snapshot file
+     * @param threads Threads rebuilding the squares (0 = hardware concurrency)
+     * @return std::unique_ptr<Game> Restored game
+     * @throws std::runtime_error if the file is missing or invalid
+     */
+    static std::unique_ptr<Game> load(const std::string& path, unsigned int threads = 0);
+};
+
+#endif // GAMESNAPSHOT_H
@@ -5,32 +5,35 @@
 
 
 #include "Hobbit.h"
+#include "RaceTraits.h"
 
 Hobbit::Hobbit(std::string charName)
-    : Character(charName, 25, 20, 70, 85) {
+    : Character(charName, raceTraits(Race::Hobbit).attack, raceTraits(Race::Hobbit).defence,
+                raceTraits(Race::Hobbit).health, raceTraits(Race::Hobbit).strength) {
     // Base stats passed to Character constructor
 }
 
 
 double Hobbit::getAttackChance(bool isDaytime) const {
     // Hobbits have 1/3 attack chance
-    return 1.0 / 3.0;
+    return raceTraits(Race::Hobbit).attackChance[isDaytime];
 }
 
 double Hobbit::getDefenceChance(bool isDaytime) const {
     // Hobbits have 2/3 defence chance
-    return 2.0 / 3.0;
+    return raceTraits(Race::Hobbit).defenceChance[isDaytime];
 }
 
-int Hobbit::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const {
+int Hobbit::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                     double effectRoll) const {
     // Hobbit special ability: Successful defences cause 0-5 random damage
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 5);
-
-    return dis(gen); // Random damage between 0-5
+    return raceTraits(Race::Hobbit).defenceRule[isDaytime].apply(attackerAttack, getDefence(), effectRoll);
 }
 
 std::string Hobbit::getRace() const {
-    return "Hobbit";
+    return raceTraits(Race::Hobbit).name;
+}
+
+Race Hobbit::getRaceId() const {
+    return Race::Hobbit;
 }
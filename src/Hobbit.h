@@ -7,7 +7,6 @@
 #define HOBBIT_H
 
 #include "Character.h"
-#include <random>
 
 /**
  * @class Hobbit
@@ -26,8 +25,10 @@ public:
 
     double getAttackChance(bool isDaytime) const override;
     double getDefenceChance(bool isDaytime) const override;
-    int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const override;
+    int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                 double effectRoll) const override;
     std::string getRace() const override;
+    Race getRaceId() const override;
 };
 
 #endif // HOBBIT_H
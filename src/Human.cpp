@@ -4,28 +4,35 @@
  */
 
 #include "Human.h"
+#include "RaceTraits.h"
 
 Human::Human(std::string charName)
-    : Character(charName, 30, 20, 60, 100) {
+    : Character(charName, raceTraits(Race::Human).attack, raceTraits(Race::Human).defence,
+                raceTraits(Race::Human).health, raceTraits(Race::Human).strength) {
     // Base stats passed to Character constructor
     // Inventory is automatically initialized with strength capacity
 }
 
 double Human::getAttackChance(bool isDaytime) const {
     // Humans have 2/3 attack chance (both day and night)
-    return 2.0 / 3.0;
+    return raceTraits(Race::Human).attackChance[isDaytime];
 }
 
 double Human::getDefenceChance(bool isDaytime) const {
     // Humans have 1/2 defence chance (both day and night)
-    return 1.0 / 2.0;
+    return raceTraits(Race::Human).defenceChance[isDaytime];
 }
 
-int Human::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const {
+int Human::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                    double effectRoll) const {
     // Human special ability: Successful defences never cause damage
-    return 0;
+    return raceTraits(Race::Human).defenceRule[isDaytime].apply(attackerAttack, getDefence(), effectRoll);
 }
 
 std::string Human::getRace() const {
-    return "Human";
+    return raceTraits(Race::Human).name;
+}
+
+Race Human::getRaceId() const {
+    return Race::Human;
 }
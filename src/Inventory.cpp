@@ -11,7 +11,7 @@
  * @param maxCapacity Maximum weight the inventory can hold
  */
 Inventory::Inventory(int maxCapacity)
-    : currentWeight(0), maxWeight(maxCapacity) {
+    : currentWeight(0), maxWeight(maxCapacity), categoryMask(0), totals{0, 0, 0, 0} {
     // Initialize with zero weight and set maximum capacity
 }
 
@@ -33,21 +33,37 @@ bool Inventory::addItem(std::shared_ptr<Item> item) {
         return false;
     }
 
+    // Only catalog item types can be stored
+    ItemId itemId = item->getTypeId();
+    if (!ItemCatalog::isValid(itemId)) {
+        itemId = ItemCatalog::findByName(item->getName());
+    }
+    return addItem(itemId);
+}
+
+bool Inventory::addItem(ItemId itemId) {
+    if (!ItemCatalog::isValid(itemId)) {
+        return false;
+    }
+    const ItemCatalog::Entry& item = ItemCatalog::getEntry(itemId);
+
     // Check if adding this item would exceed our weight capacity
-    if (currentWeight + item->getWeight() > maxWeight) {
+    if (currentWeight + item.weight > maxWeight) {
         return false; // Too heavy to carry
     }
 
     // Check category restrictions: only one of each category except rings
-    // Rings can be carried in unlimited quantities
-    if (item->getCategory() != "Ring" && isCategoryFull(item->getCategory())) {
+    // Rings are never marked in the mask, so they pass in unlimited quantities
+    if (isCategoryFull(item.category)) {
         return false; // Already have an item of this category
     }
 
     // All checks passed - add the item to our inventory vector
-    items.push_back(item);
-    // Update the current weight total
-    currentWeight += item->getWeight();
+    items.push_back(itemId);
+    // Update the current weight total and mark the category as held
+    currentWeight += item.weight;
+    markCategory(item.category, true);
+    applyModifications(itemId, +1);
     return true; // Successfully added
 }
 
@@ -65,14 +81,16 @@ bool Inventory::addItem(std::shared_ptr<Item> item) {
 bool Inventory::removeItem(const std::string& itemName) {
     // Use STL algorithm to find the item by name
     auto it = std::find_if(items.begin(), items.end(),
-                           [&itemName](const std::shared_ptr<Item>& item) {
-                               return item->getName() == itemName; // Lambda comparison
+                           [&itemName](ItemId item) {
+                               return ItemCatalog::getEntry(item).name == itemName; // Lambda comparison
                            });
 
     // Check if we found the item
     if (it != items.end()) {
         // Item found - subtract its weight from current total
-        currentWeight -= (*it)->getWeight();
+        currentWeight -= ItemCatalog::getEntry(*it).weight;
+        markCategory(ItemCatalog::getEntry(*it).category, false);
+        applyModifications(*it, -1);
         // Remove from vector using iterator
         items.erase(it);
         return true; // Successfully removed
@@ -92,7 +110,9 @@ bool Inventory::removeItem(int index) {
     }
 
     // Subtract the item's weight before removing it
-    currentWeight -= items[index]->getWeight();
+    currentWeight -= ItemCatalog::getEntry(items[index]).weight;
+    markCategory(ItemCatalog::getEntry(items[index]).category, false);
+    applyModifications(items[index], -1);
     // Remove item at the specified index
     items.erase(items.begin() + index);
     return true;
@@ -111,7 +131,7 @@ bool Inventory::canCarry(int additionalWeight) const {
     return currentWeight + additionalWeight <= maxWeight;
 }
 
-const std::vector<std::shared_ptr<Item>>& Inventory::getItems() const {
+const std::vector<ItemId>& Inventory::getItems() const {
     return items;
 }
 
@@ -120,7 +140,7 @@ std::shared_ptr<Item> Inventory::getItem(int index) const {
     if (index < 0 || index >= static_cast<int>(items.size())) {
         return nullptr; // Invalid index returns null
     }
-    return items[index]; // Return shared pointer to item
+    return ItemCatalog::share(items[index]); // Non-owning pointer to the flyweight
 }
 
 int Inventory::getItemCount() const {
@@ -128,18 +148,19 @@ int Inventory::getItemCount() const {
 }
 
 /**
- * @brief Calculates the total stat modifications from all equipped items
+ * @brief Recalculates the total stat modifications from all equipped items
  * @return ItemStats structure with summed modifications
  */
-Inventory::ItemStats Inventory::getTotalModifications() const {
+Inventory::ItemStats Inventory::recalculateTotalModifications() const {
     ItemStats stats = {0, 0, 0, 0}; // Initialize all stats to zero
 
     // Iterate through all items and sum their modifications
-    for (const auto& item : items) {
-        stats.attack += item->getAttackMod();
-        stats.defence += item->getDefenceMod();
-        stats.health += item->getHealthMod();
-        stats.strength += item->getStrengthMod();
+    for (ItemId item : items) {
+        const Item& stock = ItemCatalog::get(item);
+        stats.attack += stock.getAttackMod();
+        stats.defence += stock.getDefenceMod();
+        stats.health += stock.getHealthMod();
+        stats.strength += stock.getStrengthMod();
     }
 
     return stats;
@@ -151,18 +172,38 @@ Inventory::ItemStats Inventory::getTotalModifications() const {
  * @return bool True if category is full (cannot add more)
  */
 bool Inventory::isCategoryFull(const std::string& category) const {
-    // Rings have no limit - can carry unlimited rings
-    if (category == "Ring") {
-        return false;
-    }
+    // Map the name onto the enum check; rings (and unknown names) have no limit
+    if (category == "Weapon") return isCategoryFull(ItemCategory::Weapon);
+    if (category == "Armour") return isCategoryFull(ItemCategory::Armour);
+    if (category == "Shield") return isCategoryFull(ItemCategory::Shield);
+    return false;
+}
 
-    // For non-ring categories, check if we already have one
-    for (const auto& item : items) {
-        if (item->getCategory() == category) {
-            return true; // Found one - category is full
-        }
+/**
+ * @brief Adds or subtracts an item type's stat modifications from the totals
+ * @param itemId Catalog item id
+ * @param sign +1 for an added item, -1 for a removed one
+ */
+void Inventory::applyModifications(ItemId itemId, int sign) {
+    const ItemCatalog::Entry& entry = ItemCatalog::getEntry(itemId);
+    totals.attack += sign * entry.attackMod;
+    totals.defence += sign * entry.defenceMod;
+    totals.health += sign * entry.healthMod;
+    totals.strength += sign * entry.strengthMod;
+}
+
+/**
+ * @brief Sets or clears a category's bit in the occupancy mask
+ * @param category Category of the item added or removed
+ * @param held True when an item of the category was added
+ */
+void Inventory::markCategory(ItemCategory category, bool held) {
+    // Rings are unlimited, so their bit is never set
+    if (category == ItemCategory::Ring) {
+        return;
     }
-    return false; // No items of this category found
+    std::uint8_t bit = static_cast<std::uint8_t>(1u << static_cast<int>(category));
+    categoryMask = held ? (categoryMask | bit) : (categoryMask & ~bit);
 }
 
 /**
@@ -180,12 +221,12 @@ std::string Inventory::getInventorySummary() const {
         // List all items with their descriptions
         for (size_t i = 0; i < items.size(); ++i) {
             summary += "  " + std::to_string(i + 1) + ". " +
-                       items[i]->getDescription() + "\n";
+                       ItemCatalog::get(items[i]).getDescription() + "\n";
         }
     }
 
     // Add total stat modifications
-    auto mods = getTotalModifications();
+    const auto& mods = getTotalModifications();
     summary += "Total Modifications: ";
     summary += "Attack: " + std::to_string(mods.attack) + ", ";
     summary += "Defence: " + std::to_string(mods.defence) + ", ";
@@ -201,4 +242,6 @@ std::string Inventory::getInventorySummary() const {
 void Inventory::clear() {
     items.clear();      // Remove all items from vector
     currentWeight = 0;  // Reset weight counter
+    categoryMask = 0;   // No categories held
+    totals = ItemStats{0, 0, 0, 0};
 }
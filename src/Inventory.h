@@ -9,20 +9,37 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <cstdint>
 #include "Item.h"
+#include "ItemCatalog.h"
 
 /**
  * @class Inventory
  * @brief Manages character's items using STL dynamic containers
  *
  * Uses std::vector for unbounded item storage as required by the project.
+ * Items are held as ItemCatalog ids, so carrying an item allocates nothing.
  * Implements weight constraints and category restrictions.
  */
 class Inventory {
+public:
+    /**
+     * @struct ItemStats
+     * @brief Summed stat modifications of a set of items
+     */
+    struct ItemStats {
+        int attack;
+        int defence;
+        int health;
+        int strength;
+    };
+
 private:
-    std::vector<std::shared_ptr<Item>> items;
+    std::vector<ItemId> items;
     int currentWeight;
     int maxWeight;
+    std::uint8_t categoryMask; // Bit per ItemCategory held (rings are never marked)
+    ItemStats totals;          // Running sum of every held item's modifications
 
 public:
     /**
@@ -44,6 +61,13 @@ public:
      */
     bool addItem(std::shared_ptr<Item> item);
 
+    /**
+     * @brief Attempt to add a catalog item to inventory by type id
+     * @param itemId Catalog item id
+     * @return bool True if item was added successfully
+     */
+    bool addItem(ItemId itemId);
+
     /**
      * @brief Remove an item from inventory by name
      * @param itemName Name of item to remove
@@ -84,14 +108,14 @@ public:
 
     /**
      * @brief Get all items in inventory
-     * @return const std::vector<std::shared_ptr<Item>>& Reference to items vector
+     * @return const std::vector<ItemId>& Reference to the item ids, in pick-up order
      */
-    const std::vector<std::shared_ptr<Item>>& getItems() const;
+    const std::vector<ItemId>& getItems() const;
 
     /**
      * @brief Get item by index
      * @param index Position in inventory
-     * @return std::shared_ptr<Item> Pointer to item or nullptr
+     * @return std::shared_ptr<Item> Non-owning pointer to the catalog item, or nullptr
      */
     std::shared_ptr<Item> getItem(int index) const;
 
@@ -102,24 +126,40 @@ public:
     int getItemCount() const;
 
     /**
-     * @brief Calculate total stat modifications from all items
-     * @return struct containing total modifications
+     * @brief Get total stat modifications from all items
+     * @return const ItemStats& Running totals, kept up to date on every change
+     *
+     * O(1): the totals are adjusted by addItem, removeItem and clear rather
+     * than recomputed here.
      */
-    struct ItemStats {
-        int attack;
-        int defence;
-        int health;
-        int strength;
-    };
-    ItemStats getTotalModifications() const;
+    const ItemStats& getTotalModifications() const { return totals; }
+
+    /**
+     * @brief Recompute total stat modifications by walking every item
+     * @return ItemStats Freshly summed modifications
+     *
+     * Reference path for checking and benchmarking the running totals.
+     */
+    ItemStats recalculateTotalModifications() const;
 
     /**
      * @brief Check if category limit is reached (for non-ring items)
-     * @param category Item category to check
+     * @param category Item category name to check
      * @return bool True if category is at capacity
      */
     bool isCategoryFull(const std::string& category) const;
 
+    /**
+     * @brief Check if category limit is reached (for non-ring items)
+     * @param category Item category to check
+     * @return bool True if category is at capacity
+     *
+     * A single bit test against the category-occupancy mask.
+     */
+    bool isCategoryFull(ItemCategory category) const {
+        return (categoryMask >> static_cast<int>(category)) & 1u;
+    }
+
     /**
      * @brief Get inventory summary for display
      * @return std::string Formatted inventory summary
@@ -131,6 +171,20 @@ public:
      */
     void clear();
 
+private:
+    /**
+     * @brief Update the category-occupancy mask after an add or remove
+     * @param category Category of the item
+     * @param held True if the item was added, false if removed
+     */
+    void markCategory(ItemCategory category, bool held);
+
+    /**
+     * @brief Add or subtract one item type's modifications from the totals
+     * @param itemId Catalog item id
+     * @param sign +1 when the item is added, -1 when removed
+     */
+    void applyModifications(ItemId itemId, int sign);
 };
 
 #endif // INVENTORY_H
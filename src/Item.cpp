@@ -2,7 +2,16 @@
  * @file Item.cpp
  * @brief Implementation of abstract Item class
  *
- * Note: This file contains no implementations since Item is abstract.
- * All concrete implementations are in derived classes.
+ * Only the catalog type id lives here; all item behaviour is
+ * implemented in the derived classes.
  */
 #include "Item.h"
+#include "ItemCatalog.h"
+
+Item::Item() : typeId(ItemCatalog::NONE) {
+    // Not a catalog item until ItemCatalog assigns an id
+}
+
+ItemId Item::getTypeId() const {
+    return typeId;
+}
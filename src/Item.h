@@ -8,6 +8,25 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
+
+/**
+ * @brief Small integer identifying a stock item type in the ItemCatalog
+ */
+using ItemId = std::uint8_t;
+
+/**
+ * @enum ItemCategory
+ * @brief Equipment slot an item belongs to
+ *
+ * Values are bit positions in Inventory's category-occupancy mask.
+ */
+enum class ItemCategory : std::uint8_t {
+    Weapon = 0,
+    Armour = 1,
+    Shield = 2,
+    Ring = 3
+};
 
 /**
  * @class Item
@@ -17,12 +36,30 @@
  * to handle different item types through a common interface.
  */
 class Item {
+private:
+    ItemId typeId;
+
+    // The catalog stamps the ids of its shared stock items
+    friend class ItemCatalog;
+
+protected:
+    /**
+     * @brief Constructor for Item (type id unset until catalogued)
+     */
+    Item();
+
 public:
     /**
      * @brief Virtual destructor for proper polymorphism
      */
     virtual ~Item() = default;
 
+    /**
+     * @brief Get the catalog type id of this item
+     * @return ItemId Type id, or ItemCatalog::NONE for items outside the catalog
+     */
+    ItemId getTypeId() const;
+
     /**
      * @brief Get the item's name
      * @return std::string The name of the item
@@ -35,6 +72,12 @@ public:
      */
     virtual std::string getCategory() const = 0;
 
+    /**
+     * @brief Get the item's category as an enum
+     * @return ItemCategory The category, cheap to compare
+     */
+    virtual ItemCategory getCategoryId() const = 0;
+
     /**
      * @brief Get the item's weight
      * @return int The weight of the item
@@ -0,0 +1,98 @@
+/**
+ * @file ItemCatalog.cpp
+ * @brief Implementation of ItemCatalog flyweight table
+ */
+
+#include "ItemCatalog.h"
+#include "Weapon.h"
+#include "Armour.h"
+#include "Shield.h"
+#include "Ring.h"
+#include <array>
+#include <unordered_map>
+
+namespace {
+
+// Item specification, indexed by ItemId
+const ItemCatalog::Entry entries[ItemCatalog::COUNT] = {
+    // name, category, weight, attack, defence, health, strength
+    {"Sword",            ItemCategory::Weapon, 10,  10,   0,   0,   0},
+    {"Dagger",           ItemCategory::Weapon,  5,   5,   0,   0,   0},
+    {"Plate Armour",     ItemCategory::Armour, 40,  -5,  10,   0,   0},
+    {"Leather Armour",   ItemCategory::Armour, 20,   0,   5,   0,   0},
+    {"Large Shield",     ItemCategory::Shield, 30,  -5,  10,   0,   0},
+    {"Small Shield",     ItemCategory::Shield, 10,   0,   5,   0,   0},
+    {"Ring of Life",     ItemCategory::Ring,    1,   0,   0,  10,   0},
+    {"Ring of Strength", ItemCategory::Ring,    1,   0,   0, -10,  50}
+};
+
+/**
+ * @brief Build the concrete item object described by a table entry
+ * @param entry Catalog entry
+ * @return std::unique_ptr<Item> New item of the entry's category
+ */
+std::unique_ptr<Item> makeInstance(const ItemCatalog::Entry& entry) {
+    std::string name(entry.name);
+    switch (entry.category) {
+    case ItemCategory::Weapon:
+        return std::make_unique<Weapon>(name, entry.weight, entry.attackMod);
+    case ItemCategory::Armour:
+        return std::make_unique<Armour>(name, entry.weight, entry.defenceMod, entry.attackMod);
+    case ItemCategory::Shield:
+        return std::make_unique<Shield>(name, entry.weight, entry.defenceMod, entry.attackMod);
+    case ItemCategory::Ring:
+    default:
+        return std::make_unique<Ring>(name, entry.weight, entry.healthMod, entry.strengthMod);
+    }
+}
+
+} // namespace
+
+/**
+ * @struct ItemCatalogInstances
+ * @brief The single shared instance of every item type, built once
+ */
+struct ItemCatalogInstances {
+    std::array<std::unique_ptr<Item>, ItemCatalog::COUNT> items;
+    std::unordered_map<std::string_view, ItemId> byName;
+
+    ItemCatalogInstances() {
+        for (ItemId id = 0; id < ItemCatalog::COUNT; ++id) {
+            items[id] = makeInstance(entries[id]);
+            ItemCatalog::stamp(*items[id], id);
+            byName.emplace(entries[id].name, id);
+        }
+    }
+
+    static ItemCatalogInstances& get() {
+        static ItemCatalogInstances instances; // Thread-safe one-time construction
+        return instances;
+    }
+};
+
+const ItemCatalog::Entry& ItemCatalog::getEntry(ItemId id) {
+    return entries[id];
+}
+
+const Item& ItemCatalog::get(ItemId id) {
+    return *ItemCatalogInstances::get().items[id];
+}
+
+std::shared_ptr<Item> ItemCatalog::share(ItemId id) {
+    if (!isValid(id)) {
+        return nullptr;
+    }
+    // Aliasing constructor with an empty owner: points at the flyweight
+    // without allocating or reference counting
+    return std::shared_ptr<Item>(std::shared_ptr<Item>(), ItemCatalogInstances::get().items[id].get());
+}
+
+ItemId ItemCatalog::findByName(std::string_view name) {
+    const auto& byName = ItemCatalogInstances::get().byName;
+    auto found = byName.find(name);
+    return found != byName.end() ? found->second : NONE;
+}
+
+void ItemCatalog::stamp(Item& item, ItemId id) {
+    item.typeId = id;
+}
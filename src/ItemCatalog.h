@@ -0,0 +1,109 @@
+/**
+ * @file ItemCatalog.h
+ * @brief Immutable table of every stock item type (flyweight catalog)
+ */
+
+#ifndef ITEMCATALOG_H
+#define ITEMCATALOG_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include "Item.h"
+
+/**
+ * @class ItemCatalog
+ * @brief Flyweight table holding one shared instance of each item type
+ *
+ * There are only eight stock items, so the board and inventories refer
+ * to them by ItemId instead of owning separate objects. Each type has a
+ * single immutable Item instance here; share() hands it out as a
+ * non-owning std::shared_ptr that costs no allocation and no reference
+ * counting.
+ */
+class ItemCatalog {
+public:
+    static constexpr ItemId SWORD = 0;
+    static constexpr ItemId DAGGER = 1;
+    static constexpr ItemId PLATE_ARMOUR = 2;
+    static constexpr ItemId LEATHER_ARMOUR = 3;
+    static constexpr ItemId LARGE_SHIELD = 4;
+    static constexpr ItemId SMALL_SHIELD = 5;
+    static constexpr ItemId RING_OF_LIFE = 6;
+    static constexpr ItemId RING_OF_STRENGTH = 7;
+
+    /**
+     * @brief Number of item types in the catalog
+     */
+    static constexpr int COUNT = 8;
+
+    /**
+     * @brief Id meaning "no item" (matches BoardOccupancy::NONE)
+     */
+    static constexpr ItemId NONE = 0xFF;
+
+    /**
+     * @struct Entry
+     * @brief Static description of one item type
+     */
+    struct Entry {
+        std::string_view name;
+        ItemCategory category;
+        int weight;
+        int attackMod;
+        int defenceMod;
+        int healthMod;
+        int strengthMod;
+    };
+
+    /**
+     * @brief Check whether an id names a catalog item
+     * @param id Item id to check
+     * @return bool True for ids 0 to COUNT - 1
+     */
+    static bool isValid(ItemId id) { return id < COUNT; }
+
+    /**
+     * @brief Get the table entry for an item type
+     * @param id Valid item id
+     * @return const Entry& Interned name, category and stats
+     */
+    static const Entry& getEntry(ItemId id);
+
+    /**
+     * @brief Get the shared instance of an item type
+     * @param id Valid item id
+     * @return const Item& Flyweight item
+     */
+    static const Item& get(ItemId id);
+
+    /**
+     * @brief Get the shared instance as a non-owning smart pointer
+     * @param id Item id
+     * @return std::shared_ptr<Item> Pointer to the flyweight, or nullptr for an invalid id
+     *
+     * The pointer has no control block, so copying it never touches a
+     * reference count; the catalog instance lives for the whole program.
+     */
+    static std::shared_ptr<Item> share(ItemId id);
+
+    /**
+     * @brief Look up an item type by name
+     * @param name Item name (exact match)
+     * @return ItemId Matching id, or NONE
+     */
+    static ItemId findByName(std::string_view name);
+
+private:
+    /**
+     * @brief Record an item's catalog id on the instance itself
+     * @param item Catalog instance
+     * @param id Its item id
+     */
+    static void stamp(Item& item, ItemId id);
+
+    // Builds the instance table and needs stamp()
+    friend struct ItemCatalogInstances;
+};
+
+#endif // ITEMCATALOG_H
@@ -4,50 +4,52 @@
  */
 
 #include "ItemFactory.h"
-#include <random> // For random item generation
+#include "ItemCatalog.h"
+
+// Stock items are shared flyweights from the ItemCatalog; no allocation happens here
 
 // Create specific weapon items according to project specification
 std::shared_ptr<Item> ItemFactory::createSword() {
     // Sword: weight 10, attack +10
-    return std::make_shared<Weapon>("Sword", 10, 10);
+    return ItemCatalog::share(ItemCatalog::SWORD);
 }
 
 std::shared_ptr<Item> ItemFactory::createDagger() {
     // Dagger: weight 5, attack +5
-    return std::make_shared<Weapon>("Dagger", 5, 5);
+    return ItemCatalog::share(ItemCatalog::DAGGER);
 }
 
 // Create armour items with defence bonuses and possible attack penalties
 std::shared_ptr<Item> ItemFactory::createPlateArmour() {
     // Plate Armour: weight 40, defence +10, attack -5
-    return std::make_shared<Armour>("Plate Armour", 40, 10, -5);
+    return ItemCatalog::share(ItemCatalog::PLATE_ARMOUR);
 }
 
 std::shared_ptr<Item> ItemFactory::createLeatherArmour() {
     // Leather Armour: weight 20, defence +5, no attack penalty
-    return std::make_shared<Armour>("Leather Armour", 20, 5);
+    return ItemCatalog::share(ItemCatalog::LEATHER_ARMOUR);
 }
 
 // Create shield items with defence bonuses and possible attack penalties
 std::shared_ptr<Item> ItemFactory::createLargeShield() {
     // Large Shield: weight 30, defence +10, attack -5
-    return std::make_shared<Shield>("Large Shield", 30, 10, -5);
+    return ItemCatalog::share(ItemCatalog::LARGE_SHIELD);
 }
 
 std::shared_ptr<Item> ItemFactory::createSmallShield() {
     // Small Shield: weight 10, defence +5, no attack penalty
-    return std::make_shared<Shield>("Small Shield", 10, 5);
+    return ItemCatalog::share(ItemCatalog::SMALL_SHIELD);
 }
 
 // Create ring items with special stat modifications
 std::shared_ptr<Item> ItemFactory::createRingOfLife() {
     // Ring of Life: weight 1, health +10
-    return std::make_shared<Ring>("Ring of Life", 1, 10, 0);
+    return ItemCatalog::share(ItemCatalog::RING_OF_LIFE);
 }
 
 std::shared_ptr<Item> ItemFactory::createRingOfStrength() {
     // Ring of Strength: weight 1, strength +50, health -10 (trade-off)
-    return std::make_shared<Ring>("Ring of Strength", 1, -10, 50);
+    return ItemCatalog::share(ItemCatalog::RING_OF_STRENGTH);
 }
 
 /**
@@ -69,26 +71,33 @@ std::vector<std::shared_ptr<Item>> ItemFactory::getAllItemTypes() {
 
 /**
  * @brief Creates a random item for populating the game board
+ * @param rng Caller's random stream
  * @return std::shared_ptr<Item> Randomly selected item
  */
-std::shared_ptr<Item> ItemFactory::createRandomItem() {
-    // Set up random number generation
-    static std::random_device rd;  // True random seed
-    static std::mt19937 gen(rd()); // Mersenne Twister generator
-    static std::uniform_int_distribution<> dis(0, 7); // Range: 0-7 (8 items)
+std::shared_ptr<Item> ItemFactory::createRandomItem(Rng& rng) {
+    int choice = static_cast<int>(rng.nextBelow(ITEM_TYPE_COUNT)); // Random number 0-7
 
-    int choice = dis(gen); // Generate random number 0-7
+    return createItem(choice);
+}
 
-    // Map random number to specific item type
-    switch (choice) {
-    case 0: return createSword();
-    case 1: return createDagger();
-    case 2: return createPlateArmour();
-    case 3: return createLeatherArmour();
-    case 4: return createLargeShield();
-    case 5: return createSmallShield();
-    case 6: return createRingOfLife();
-    case 7: return createRingOfStrength();
-    default: return createSword(); // Fallback (should never happen)
+/**
+ * @brief Creates an item from its numeric type id
+ * @param typeId Item type id (0 to ITEM_TYPE_COUNT - 1)
+ * @return std::shared_ptr<Item> New item or nullptr if id is unknown
+ */
+std::shared_ptr<Item> ItemFactory::createItem(int typeId) {
+    if (typeId < 0 || typeId >= ITEM_TYPE_COUNT) {
+        return nullptr;
     }
+    return ItemCatalog::share(static_cast<ItemId>(typeId));
+}
+
+/**
+ * @brief Maps an item name back to its numeric type id
+ * @param itemName Name of the item
+ * @return int Type id or -1 if name is unknown
+ */
+int ItemFactory::getItemTypeId(const std::string& itemName) {
+    ItemId id = ItemCatalog::findByName(itemName);
+    return id == ItemCatalog::NONE ? -1 : id;
 }
@@ -12,16 +12,28 @@
 #include "Armour.h"
 #include "Shield.h"
 #include "Ring.h"
+#include "ItemCatalog.h"
+#include "Rng.h"
 
 /**
  * @class ItemFactory
  * @brief Creates predefined game items using factory pattern
  *
  * Provides static methods to create all required items from the specification.
- * This centralizes item creation and makes it easy to extend.
+ * This centralizes item creation and makes it easy to extend. Stock items
+ * are handed out as non-owning pointers to the ItemCatalog flyweights.
  */
 class ItemFactory {
 public:
+    /**
+     * @brief Number of distinct item types the factory can create
+     *
+     * Type ids are ItemCatalog ids: Sword, Dagger, Plate Armour,
+     * Leather Armour, Large Shield, Small Shield, Ring of Life,
+     * Ring of Strength.
+     */
+    static constexpr int ITEM_TYPE_COUNT = ItemCatalog::COUNT;
+
     // Weapon creations
     static std::shared_ptr<Item> createSword();
     static std::shared_ptr<Item> createDagger();
@@ -46,9 +58,24 @@ public:
 
     /**
      * @brief Create a random item for board initialization
+     * @param rng Random stream to draw from
      * @return std::shared_ptr<Item> Randomly selected item
      */
-    static std::shared_ptr<Item> createRandomItem();
+    static std::shared_ptr<Item> createRandomItem(Rng& rng);
+
+    /**
+     * @brief Create an item from its type id
+     * @param typeId Item type id (0 to ITEM_TYPE_COUNT - 1)
+     * @return std::shared_ptr<Item> New item, or nullptr for an unknown id
+     */
+    static std::shared_ptr<Item> createItem(int typeId);
+
+    /**
+     * @brief Look up the type id of an item by its name
+     * @param itemName Name of the item
+     * @return int Type id, or -1 if the name is not a known item
+     */
+    static int getItemTypeId(const std::string& itemName);
 };
 
 #endif // ITEMFACTORY_H
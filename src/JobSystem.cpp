@@ -0,0 +1,173 @@
+/**
+ * @file JobSystem.cpp
+ * @brief Implementation of JobSystem class
+ */
+
+#include "JobSystem.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+std::uint64_t packRange(std::uint64_t begin, std::uint64_t end) {
+    return begin | (end << 32);
+}
+
+std::size_t rangeBegin(std::uint64_t range) {
+    return static_cast<std::size_t>(range & 0xFFFFFFFFu);
+}
+
+std::size_t rangeEnd(std::uint64_t range) {
+    return static_cast<std::size_t>(range >> 32);
+}
+
+} // namespace
+
+JobSystem::JobSystem(unsigned int threads)
+    : threadCount(threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads),
+    queues(new Queue[threadCount]) {
+    // Queue 0 belongs to whichever thread calls parallelFor()
+    for (unsigned int t = 1; t < threadCount; ++t) {
+        workers.emplace_back(&JobSystem::workerLoop, this, t);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Run job(i) for every i in [0, count) and wait for all of them
+ *
+ * Pseudo-code:
+ * 1. Give each thread an equal contiguous share of the indices
+ * 2. Wake the workers and run the caller's share alongside them
+ * 3. Wait until every worker has found nothing left to run or steal
+ * 4. Rethrow the first exception a job raised, if any
+ */
+void JobSystem::parallelFor(std::size_t count, const std::function<void(std::size_t)>& job) {
+    if (count > 0xFFFFFFFFu) {
+        throw std::length_error("Too many jobs for one parallelFor call");
+    }
+    if (count == 0) {
+        return;
+    }
+
+    for (unsigned int t = 0; t < threadCount; ++t) {
+        queues[t].range.store(packRange(count * t / threadCount, count * (t + 1) / threadCount),
+                              std::memory_order_relaxed);
+    }
+    failed.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentJob = &job;
+        running = static_cast<unsigned int>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+
+    runJobs(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return running == 0; });
+        currentJob = nullptr;
+        error = failure;
+        failure = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::workerLoop(unsigned int index) {
+    std::uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        runJobs(index);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0) {
+            done.notify_one();
+        }
+    }
+}
+
+void JobSystem::runJobs(unsigned int index) {
+    std::size_t job;
+    while (takeOwn(index, job) || steal(index, job)) {
+        if (failed.load(std::memory_order_relaxed)) {
+            continue; // Drain the queues without running anything more
+        }
+        try {
+            (*currentJob)(job);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) {
+                failure = std::current_exception();
+            }
+            failed.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool JobSystem::takeOwn(unsigned int index, std::size_t& job) {
+    std::atomic<std::uint64_t>& range = queues[index].range;
+    std::uint64_t current = range.load(std::memory_order_acquire);
+    for (;;) {
+        const std::size_t begin = rangeBegin(current);
+        const std::size_t end = rangeEnd(current);
+        if (begin >= end) {
+            return false;
+        }
+        if (range.compare_exchange_weak(current, packRange(begin + 1, end), std::memory_order_acq_rel,
+                                        std::memory_order_acquire)) {
+            job = begin;
+            return true;
+        }
+    }
+}
+
+bool JobSystem::steal(unsigned int index, std::size_t& job) {
+    // Start with the next thread along, so thieves spread over the victims
+    for (unsigned int offset = 1; offset < threadCount; ++offset) {
+        std::atomic<std::uint64_t>& range = queues[(index + offset) % threadCount].range;
+        std::uint64_t current = range.load(std::memory_order_acquire);
+        for (;;) {
+            const std::size_t begin = rangeBegin(current);
+            const std::size_t end = rangeEnd(current);
+            if (begin >= end) {
+                break;
+            }
+            // The victim keeps [begin, middle); a single job is taken whole
+            const std::size_t middle = begin + (end - begin) / 2;
+            if (range.compare_exchange_weak(current, packRange(begin, middle), std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+                // Nobody writes an empty queue, so the own one can simply be set.
+                // Indices are handed out once per call, so a thief holding an
+                // old copy of this queue can never see the same value again.
+                queues[index].range.store(packRange(middle + 1, end), std::memory_order_release);
+                steals.fetch_add(1, std::memory_order_relaxed);
+                job = middle;
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file JobSystem.h
+ * @brief Fixed pool of worker threads running indexed jobs with work stealing
+ */
+
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class JobSystem
+ * @brief Runs jobs 0..count-1 across a pool of threads that steal from each other
+ *
+ * parallelFor() deals the job indices out as one contiguous range per
+ * thread. Each thread takes jobs from the front of its own range; a
+ * thread whose range runs dry steals the back half of another thread's
+ * range, so uneven jobs still keep every thread busy. A range is a single
+ * atomic word, so taking and stealing never lock.
+ *
+ * The calling thread works too, so a pool of N threads starts N - 1
+ * workers. Workers sleep between calls. parallelFor() must not be called
+ * from inside a job or from two threads at once.
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Constructor for JobSystem
+     * @param threads Threads to run jobs on, including the caller (0 = all hardware threads)
+     */
+    explicit JobSystem(unsigned int threads = 0);
+
+    /**
+     * @brief Destructor - stops and joins the workers
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Get the number of threads jobs run on
+     * @return unsigned int Threads, including the caller
+     */
+    unsigned int getThreadCount() const { return threadCount; }
+
+    /**
+     * @brief Run job(i) for every i in [0, count) and wait for all of them
+     * @param count Number of jobs (at most 2^32 - 1)
+     * @param job Called once per index, on any thread
+     * @throws std::length_error if count does not fit in 32 bits
+     *
+     * If a job throws, jobs not yet started are skipped and the first
+     * exception is rethrown here once every thread has stopped.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
+    /**
+     * @brief Count successful steals since construction
+     * @return std::size_t Ranges taken from another thread
+     */
+    std::size_t getSteals() const { return steals.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @struct Queue
+     * @brief One thread's remaining jobs: begin in the low 32 bits, end in the high 32
+     */
+    struct alignas(64) Queue {
+        std::atomic<std::uint64_t> range{0};
+    };
+
+    unsigned int threadCount;
+    std::unique_ptr<Queue[]> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake; // Workers wait here for the next call
+    std::condition_variable done; // The caller waits here for the workers
+    const std::function<void(std::size_t)>* currentJob = nullptr;
+    std::uint64_t generation = 0;  // Bumped by every parallelFor()
+    unsigned int running = 0;      // Workers still inside the current call
+    bool stopping = false;
+
+    std::atomic<bool> failed{false};
+    std::exception_ptr failure; // First exception thrown by a job
+    std::atomic<std::size_t> steals{0};
+
+    /**
+     * @brief Worker thread body: run one share of every call until stopped
+     * @param index Queue owned by this thread
+     */
+    void workerLoop(unsigned int index);
+
+    /**
+     * @brief Run jobs from the own queue, then stolen ones, until none are left
+     * @param index Queue owned by the calling thread
+     */
+    void runJobs(unsigned int index);
+
+    /**
+     * @brief Take the next job from the front of the own queue
+     * @param index Queue owned by the calling thread
+     * @param job Receives the job index
+     * @return bool False if the queue is empty
+     */
+    bool takeOwn(unsigned int index, std::size_t& job);
+
+    /**
+     * @brief Move the back half of another thread's queue into the own queue
+     * @param index Queue owned by the calling thread (must be empty)
+     * @param job Receives the first stolen job, to run right away
+     * @return bool False if every other queue is empty
+     */
+    bool steal(unsigned int index, std::size_t& job);
+};
+
+#endif // JOBSYSTEM_H
@@ -4,11 +4,12 @@
  */
 
 #include "Orc.h"
+#include "RaceTraits.h"
 
 Orc::Orc(std::string charName)
-    : Character(charName, 25, 10, 50, 130),
-    dayAttack(25), dayDefence(10), nightAttack(45), nightDefence(25) {
-    // Base stats passed to Character constructor (using daytime stats as default)
+    : Character(charName, raceTraits(Race::Orc).attack, raceTraits(Race::Orc).defence,
+                raceTraits(Race::Orc).health, raceTraits(Race::Orc).strength) {
+    // Base stats passed to Character constructor; day/night effects come from the traits table
 }
 
 int Orc::getAttack() const {
@@ -24,32 +25,26 @@ int Orc::getDefence() const {
 }
 
 double Orc::getAttackChance(bool isDaytime) const {
-    if (isDaytime) {
-        return 1.0 / 4.0; // Poor attack chance during day
-    } else {
-        return 1.0; // Perfect attack chance at night
-    }
+    // Poor attack chance during day, perfect at night
+    return raceTraits(Race::Orc).attackChance[isDaytime];
 }
 
 double Orc::getDefenceChance(bool isDaytime) const {
-    if (isDaytime) {
-        return 1.0 / 4.0; // Poor defence chance during day
-    } else {
-        return 1.0 / 2.0; // Good defence chance at night
-    }
+    // Poor defence chance during day, good at night
+    return raceTraits(Race::Orc).defenceChance[isDaytime];
 }
 
-int Orc::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const {
-    if (isDaytime) {
-        // Daytime: defences cause 1/4 of adjusted damage
-        int adjustedDamage = (attackerAttack - getDefence()) / 4;
-        return adjustedDamage > 0 ? adjustedDamage : 0;
-    } else {
-        // Nighttime: defences increase health by 1
-        return -1; // Negative damage means health increase
-    }
+int Orc::processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                  double effectRoll) const {
+    // Daytime: defences cause 1/4 of adjusted damage
+    // Nighttime: defences increase health by 1
+    return raceTraits(Race::Orc).defenceRule[isDaytime].apply(attackerAttack, getDefence(), effectRoll);
 }
 
 std::string Orc::getRace() const {
-    return "Orc";
+    return raceTraits(Race::Orc).name;
+}
+
+Race Orc::getRaceId() const {
+    return Race::Orc;
 }
@@ -17,12 +17,6 @@
  * - Night: Excellent stats, defences increase health by 1
  */
 class Orc : public Character {
-private:
-    int dayAttack;
-    int dayDefence;
-    int nightAttack;
-    int nightDefence;
-
 public:
     /**
      * @brief Constructor for Orc character
@@ -34,8 +28,10 @@ public:
     int getDefence() const override;
     double getAttackChance(bool isDaytime) const override;
     double getDefenceChance(bool isDaytime) const override;
-    int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime) const override;
+    int processSuccessfulDefence(int damage, int attackerAttack, bool isDaytime,
+                                 double effectRoll) const override;
     std::string getRace() const override;
+    Race getRaceId() const override;
 };
 
 #endif // ORC_H
@@ -0,0 +1,403 @@
+/**
+ * @file Pathfinder.cpp
+ * @brief Implementation of Pathfinder class
+ */
+
+#include "Pathfinder.h"
+#include "Board.h"
+#include "ItemCatalog.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+
+/**
+ * @brief Repair falls back to a full rebuild beyond 1 changed square in this many
+ */
+constexpr std::size_t REBUILD_FRACTION = 32;
+
+/**
+ * @brief Largest pocket around a goal findPath() checks for before searching
+ */
+constexpr std::size_t POCKET_LIMIT = 128;
+
+} // namespace
+
+Pathfinder::Pathfinder(const Board& board, bool avoidEnemies)
+    : occupancy(board.getOccupancy()), width(board.getDimensions().first), height(board.getDimensions().second),
+    cellCount(occupancy.size()), avoidEnemies(avoidEnemies),
+    nodes(cellCount, Node{0, 0, 0}) {
+    if (board.getChunkedWorld()) {
+        throw std::invalid_argument("Pathfinder needs a dense board");
+    }
+}
+
+bool Pathfinder::isTarget(Target target, std::size_t cell) const {
+    switch (target) {
+    case Target::Enemy:
+        return occupancy.hasEnemy(cell);
+    case Target::Item:
+        return occupancy.hasItem(cell);
+    default: {
+        const std::uint8_t item = occupancy.getItemType(cell);
+        const auto category = static_cast<ItemCategory>(static_cast<int>(target) - static_cast<int>(Target::Weapon));
+        return item != BoardOccupancy::NONE && ItemCatalog::getEntry(item).category == category;
+    }
+    }
+}
+
+bool Pathfinder::isPassable(std::size_t cell) const {
+    return !avoidEnemies || !occupancy.hasEnemy(cell);
+}
+
+void Pathfinder::nextStamp() {
+    if (++currentStamp == 0) {
+        // Wrapped: old stamps could match again, so clear them once
+        for (Node& node : nodes) {
+            node.stamp = 0;
+        }
+        currentStamp = 1;
+    }
+}
+
+/**
+ * @brief Find a shortest route between two squares (A*)
+ * @param fromX Start X
+ * @param fromY Start Y
+ * @param toX Destination X
+ * @param toY Destination Y
+ * @return std::vector<std::pair<int, int>> Squares stepped on, ending at the destination
+ *
+ * Pseudo-code:
+ * 1. Give up at once if the goal sits in a small pocket sealed by enemies
+ * 2. Open the start square with cost 0
+ * 3. Take a square with the lowest cost + Manhattan distance. Estimates
+ *    are small integers, so open squares sit in one bucket per estimate;
+ *    within a bucket the newest (deepest) square goes first, which runs
+ *    straight across open ground instead of widening the search
+ * 4. Stop at the goal; otherwise offer each passable neighbour cost + 1
+ * 5. Walk the parent links back from the goal
+ */
+std::vector<std::pair<int, int>> Pathfinder::findPath(int fromX, int fromY, int toX, int toY) {
+    std::vector<std::pair<int, int>> path;
+    if (fromX < 0 || fromX >= width || fromY < 0 || fromY >= height ||
+        toX < 0 || toX >= width || toY < 0 || toY >= height || (fromX == toX && fromY == toY)) {
+        return path;
+    }
+
+    const std::size_t start = static_cast<std::size_t>(fromY) * width + fromX;
+    const std::size_t goal = static_cast<std::size_t>(toY) * width + toX;
+
+    // A goal sealed in a pocket by enemies would make the search flood
+    // everything reachable from the start before giving up
+    if (isSealedOff(goal, start)) {
+        return path;
+    }
+
+    // Estimates only grow, so bucket i holds squares estimated i steps
+    // longer than the straight Manhattan distance
+    for (auto& bucket : buckets) {
+        bucket.clear();
+    }
+    nextStamp();
+    nodes[start] = {currentStamp, 0, static_cast<std::uint32_t>(start)};
+    pushOpen(0, static_cast<std::uint32_t>(start), 0);
+
+    bool found = false;
+    for (std::size_t estimate = 0; estimate < buckets.size() && !found; ++estimate) {
+        // Indexed each time: pushOpen() may grow the bucket list
+        while (!buckets[estimate].empty()) {
+            const OpenEntry entry = buckets[estimate].back();
+            buckets[estimate].pop_back();
+            const std::size_t cell = entry.cell;
+            if (cell == goal) {
+                found = true;
+                break;
+            }
+            if (entry.cost != nodes[cell].cost) {
+                continue; // Reached more cheaply since this entry was queued
+            }
+
+            // Each step changes the Manhattan distance by one, so the new
+            // estimate is the same (step towards the goal) or 2 more
+            const int x = static_cast<int>(cell % static_cast<std::size_t>(width));
+            const int y = static_cast<int>(cell / static_cast<std::size_t>(width));
+            const std::uint32_t next = entry.cost + 1;
+            auto offer = [&](std::size_t neighbour, bool closer) {
+                if (neighbour != goal && !isPassable(neighbour)) return;
+                Node& node = nodes[neighbour];
+                if (node.stamp != currentStamp || next < node.cost) {
+                    node = {currentStamp, next, static_cast<std::uint32_t>(cell)};
+                    pushOpen(estimate + (closer ? 0 : 2), static_cast<std::uint32_t>(neighbour), next);
+                }
+            };
+            // The bucket is a stack: offer the axis with more distance left
+            // last, so the search keeps near the diagonal, where detours
+            // around enemies are cheapest
+            auto offerVertical = [&]() {
+                if (y > 0) offer(cell - width, toY < y);
+                if (y + 1 < height) offer(cell + width, toY > y);
+            };
+            auto offerHorizontal = [&]() {
+                if (x > 0) offer(cell - 1, toX < x);
+                if (x + 1 < width) offer(cell + 1, toX > x);
+            };
+            if (std::abs(toX - x) > std::abs(toY - y)) {
+                offerVertical();
+                offerHorizontal();
+            } else {
+                offerHorizontal();
+                offerVertical();
+            }
+        }
+    }
+    if (!found) {
+        return path;
+    }
+
+    for (std::size_t cell = goal; cell != start; cell = nodes[cell].parent) {
+        path.emplace_back(static_cast<int>(cell % width), static_cast<int>(cell / width));
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+bool Pathfinder::isSealedOff(std::size_t goal, std::size_t start) {
+    // Flood outward from the goal; running out of squares early means a pocket
+    nextStamp();
+    frontier.assign(1, goal);
+    nodes[goal].stamp = currentStamp;
+    for (std::size_t head = 0; head < frontier.size(); ++head) {
+        if (frontier.size() > POCKET_LIMIT) {
+            return false;
+        }
+        bool reachedStart = false;
+        forEachNeighbour(frontier[head], [&](std::size_t neighbour) {
+            if (neighbour == start) {
+                reachedStart = true;
+            } else if (nodes[neighbour].stamp != currentStamp && isPassable(neighbour)) {
+                nodes[neighbour].stamp = currentStamp;
+                frontier.push_back(neighbour);
+            }
+        });
+        if (reachedStart) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Pathfinder::pushOpen(std::size_t estimate, std::uint32_t cell, std::uint32_t cost) {
+    if (estimate >= buckets.size()) {
+        buckets.resize(estimate + 1);
+    }
+    buckets[estimate].push_back({cell, cost});
+}
+
+std::uint32_t Pathfinder::distanceTo(Target target, int x, int y) {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return UNREACHABLE;
+    }
+    const std::vector<std::uint32_t>& distance = getField(target);
+    const std::size_t cell = static_cast<std::size_t>(y) * width + x;
+    if (distance[cell] != UNREACHABLE) {
+        return distance[cell];
+    }
+
+    // A blocked start (the player on an enemy's square) may still step off it
+    std::uint32_t best = UNREACHABLE;
+    forEachNeighbour(cell, [&](std::size_t neighbour) {
+        if (distance[neighbour] != UNREACHABLE) best = std::min(best, distance[neighbour] + 1);
+    });
+    return best;
+}
+
+std::vector<std::pair<int, int>> Pathfinder::pathToNearest(Target target, int x, int y) {
+    std::vector<std::pair<int, int>> path;
+    std::uint32_t remaining = distanceTo(target, x, y);
+    if (remaining == UNREACHABLE || remaining == 0) {
+        return path;
+    }
+
+    // Downhill walk: some neighbour is always exactly one step closer
+    const std::vector<std::uint32_t>& distance = fields[static_cast<int>(target)].distance;
+    std::size_t cell = static_cast<std::size_t>(y) * width + x;
+    path.reserve(remaining);
+    while (remaining > 0) {
+        std::size_t next = cell;
+        forEachNeighbour(cell, [&](std::size_t neighbour) {
+            if (next == cell && distance[neighbour] == remaining - 1) next = neighbour;
+        });
+        cell = next;
+        --remaining;
+        path.emplace_back(static_cast<int>(cell % width), static_cast<int>(cell / width));
+    }
+    return path;
+}
+
+std::vector<Verb> Pathfinder::toDirections(int fromX, int fromY, const std::vector<std::pair<int, int>>& path) {
+    std::vector<Verb> directions;
+    directions.reserve(path.size());
+    for (const auto& step : path) {
+        if (step.second < fromY) {
+            directions.push_back(Verb::North);
+        } else if (step.second > fromY) {
+            directions.push_back(Verb::South);
+        } else if (step.first > fromX) {
+            directions.push_back(Verb::East);
+        } else {
+            directions.push_back(Verb::West);
+        }
+        fromX = step.first;
+        fromY = step.second;
+    }
+    return directions;
+}
+
+const std::vector<std::uint32_t>& Pathfinder::getField(Target target) {
+    Field& field = fields[static_cast<int>(target)];
+    const std::uint64_t serial = occupancy.getChangeSerial();
+    if (field.built && field.serial == serial) {
+        return field.distance;
+    }
+
+    changed.clear();
+    if (!field.built || !occupancy.getChangesSince(field.serial, changed) ||
+        changed.size() > cellCount / REBUILD_FRACTION) {
+        rebuild(target, field);
+    } else {
+        repair(target, field, changed);
+        ++repairs;
+    }
+    field.serial = serial;
+    return field.distance;
+}
+
+void Pathfinder::rebuild(Target target, Field& field) {
+    std::vector<std::uint32_t>& distance = field.distance;
+    distance.assign(cellCount, UNREACHABLE);
+    frontier.clear();
+
+    // Every target is a source at distance 0
+    const std::vector<std::uint64_t>& bits =
+        target == Target::Enemy ? occupancy.getEnemyBits() : occupancy.getItemBits();
+    for (std::size_t w = 0; w < bits.size(); ++w) {
+        std::uint64_t word = bits[w];
+        while (word) {
+            const std::size_t cell = w * 64 + BoardOccupancy::lowestBit(word);
+            word &= word - 1;
+            if (isTarget(target, cell)) {
+                distance[cell] = 0;
+                frontier.push_back(cell);
+            }
+        }
+    }
+
+    // Breadth-first: squares are reached in order of distance
+    for (std::size_t head = 0; head < frontier.size(); ++head) {
+        const std::size_t cell = frontier[head];
+        const std::uint32_t next = distance[cell] + 1;
+        forEachNeighbour(cell, [&](std::size_t neighbour) {
+            if (distance[neighbour] == UNREACHABLE && isPassable(neighbour)) {
+                distance[neighbour] = next;
+                frontier.push_back(neighbour);
+            }
+        });
+    }
+
+    field.built = true;
+    ++fullRebuilds;
+}
+
+/**
+ * @brief Repair a field after some squares changed
+ * @param target Kind of target
+ * @param field Field whose distances predate the changes
+ * @param cells Squares that changed
+ *
+ * Pseudo-code:
+ * 1. Changed squares that are not targets may have lost their distance:
+ *    mark them affected
+ * 2. In order of old distance, a neighbour one step further is affected
+ *    too unless another unaffected neighbour still supports its distance
+ * 3. Clear the affected squares, then give each affected or changed
+ *    square the distance its neighbours now allow
+ * 4. Spread shorter distances outward, shortest first (Dijkstra on unit steps)
+ */
+void Pathfinder::repair(Target target, Field& field, const std::vector<std::size_t>& cells) {
+    std::vector<std::uint32_t>& distance = field.distance;
+    nextStamp(); // stamp == currentStamp marks an affected square
+
+    // (old distance, 0 = changed square / 1 = neighbour to check, square)
+    using Entry = std::tuple<std::uint32_t, int, std::size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> raise;
+    for (std::size_t cell : cells) {
+        if (distance[cell] != UNREACHABLE && !isTarget(target, cell)) {
+            raise.emplace(distance[cell], 0, cell);
+        }
+    }
+
+    frontier.clear();
+    while (!raise.empty()) {
+        const auto [old, kind, cell] = raise.top();
+        raise.pop();
+        if (nodes[cell].stamp == currentStamp || distance[cell] != old) {
+            continue;
+        }
+        if (kind == 1) {
+            if (isTarget(target, cell)) continue;
+            bool supported = false;
+            forEachNeighbour(cell, [&](std::size_t neighbour) {
+                if (distance[neighbour] + 1 == old && nodes[neighbour].stamp != currentStamp) supported = true;
+            });
+            if (supported) continue;
+        }
+
+        nodes[cell].stamp = currentStamp;
+        frontier.push_back(cell);
+        forEachNeighbour(cell, [&](std::size_t neighbour) {
+            if (distance[neighbour] == old + 1 && nodes[neighbour].stamp != currentStamp) {
+                raise.emplace(old + 1, 1, neighbour);
+            }
+        });
+    }
+    for (std::size_t cell : frontier) {
+        distance[cell] = UNREACHABLE;
+    }
+    frontier.insert(frontier.end(), cells.begin(), cells.end());
+
+    // Refill from the surviving distances
+    using Seed = std::pair<std::uint32_t, std::size_t>;
+    std::priority_queue<Seed, std::vector<Seed>, std::greater<Seed>> lower;
+    for (std::size_t cell : frontier) {
+        std::uint32_t best = UNREACHABLE;
+        if (isTarget(target, cell)) {
+            best = 0;
+        } else if (isPassable(cell)) {
+            forEachNeighbour(cell, [&](std::size_t neighbour) {
+                if (distance[neighbour] != UNREACHABLE) best = std::min(best, distance[neighbour] + 1);
+            });
+        }
+        if (best < distance[cell]) {
+            distance[cell] = best;
+            lower.emplace(best, cell);
+        }
+    }
+    while (!lower.empty()) {
+        const auto [value, cell] = lower.top();
+        lower.pop();
+        if (value != distance[cell]) {
+            continue;
+        }
+        forEachNeighbour(cell, [&](std::size_t neighbour) {
+            if (value + 1 < distance[neighbour] && isPassable(neighbour)) {
+                distance[neighbour] = value + 1;
+                lower.emplace(value + 1, neighbour);
+            }
+        });
+    }
+}
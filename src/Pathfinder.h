@@ -0,0 +1,237 @@
+/**
+ * @file Pathfinder.h
+ * @brief Routes over a Board: A* between points and cached distance fields to the nearest target
+ */
+
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "CommandParser.h"
+
+class Board;
+class BoardOccupancy;
+
+/**
+ * @class Pathfinder
+ * @brief Finds four-way routes on a dense board
+ *
+ * Steps go north, south, east or west like Board::movePlayer(). With
+ * avoidEnemies set, squares holding an enemy block the way unless they
+ * are the start or the destination, so routes do not walk into fights.
+ *
+ * findPath() runs A* with the Manhattan heuristic. Distance fields hold,
+ * for every square, the number of steps to the nearest target of one
+ * kind (any enemy, any item, or items of one category); they are built
+ * by multi-source BFS on first use and kept in the pathfinder. Before a
+ * field is read, the board's change log (BoardOccupancy) says which
+ * squares changed, and only the distances those changes affect are
+ * repaired; a field is rebuilt from scratch only when too much changed.
+ *
+ * A pathfinder reads the board it was made for and must not outlive it.
+ * It keeps scratch state, so each thread needs its own.
+ */
+class Pathfinder {
+public:
+    /**
+     * @brief What a distance field measures the distance to
+     */
+    enum class Target : std::uint8_t {
+        Enemy,
+        Item,
+        Weapon,
+        Armour,
+        Shield,
+        Ring
+    };
+
+    /**
+     * @brief Number of Target values
+     */
+    static constexpr int TARGET_COUNT = 6;
+
+    /**
+     * @brief Distance reported for squares no target can be reached from
+     */
+    static constexpr std::uint32_t UNREACHABLE = 0xFFFFFFFFu;
+
+    /**
+     * @brief Constructor for Pathfinder
+     * @param board Dense board to route on
+     * @param avoidEnemies Treat squares holding an enemy as walls
+     * @throws std::invalid_argument for chunked boards
+     */
+    explicit Pathfinder(const Board& board, bool avoidEnemies = true);
+
+    /**
+     * @brief Find a shortest route between two squares (A*)
+     * @param fromX Start X
+     * @param fromY Start Y
+     * @param toX Destination X
+     * @param toY Destination Y
+     * @return std::vector<std::pair<int, int>> Squares stepped on, ending at the
+     *         destination; empty if the destination is unreachable or the start
+     */
+    std::vector<std::pair<int, int>> findPath(int fromX, int fromY, int toX, int toY);
+
+    /**
+     * @brief Steps from a square to the nearest target
+     * @param target Kind of target
+     * @param x Square X
+     * @param y Square Y
+     * @return std::uint32_t Steps, or UNREACHABLE
+     */
+    std::uint32_t distanceTo(Target target, int x, int y);
+
+    /**
+     * @brief Route from a square to the nearest target by following its distance field
+     * @param target Kind of target
+     * @param x Start X
+     * @param y Start Y
+     * @return std::vector<std::pair<int, int>> Squares stepped on, ending on a
+     *         target; empty if none is reachable or the start is one
+     */
+    std::vector<std::pair<int, int>> pathToNearest(Target target, int x, int y);
+
+    /**
+     * @brief Convert a route into movement commands
+     * @param fromX Start X
+     * @param fromY Start Y
+     * @param path Route from findPath() or pathToNearest()
+     * @return std::vector<Verb> Verb::North, South, East or West per step
+     */
+    static std::vector<Verb> toDirections(int fromX, int fromY, const std::vector<std::pair<int, int>>& path);
+
+    /**
+     * @brief Count distance fields built from scratch
+     * @return std::size_t Full BFS passes so far
+     */
+    std::size_t getFullRebuilds() const { return fullRebuilds; }
+
+    /**
+     * @brief Count distance fields brought up to date by local repair
+     * @return std::size_t Incremental repairs so far
+     */
+    std::size_t getRepairs() const { return repairs; }
+
+private:
+    /**
+     * @struct Field
+     * @brief Cached distances to one kind of target
+     */
+    struct Field {
+        std::vector<std::uint32_t> distance; ///< Steps per square, row-major
+        std::uint64_t serial = 0;            ///< Board change serial the distances reflect
+        bool built = false;
+    };
+
+    const BoardOccupancy& occupancy;
+    int width;
+    int height;
+    std::size_t cellCount;
+    bool avoidEnemies;
+    std::array<Field, TARGET_COUNT> fields;
+    std::size_t fullRebuilds = 0;
+    std::size_t repairs = 0;
+
+    /**
+     * @struct Node
+     * @brief Per-square search scratch, valid only while stamp == currentStamp
+     */
+    struct Node {
+        std::uint32_t stamp;
+        std::uint32_t cost;   ///< Steps from the start (A*)
+        std::uint32_t parent; ///< Previous square on the best route (A*)
+    };
+
+    /**
+     * @struct OpenEntry
+     * @brief Square waiting in an A* bucket, with the cost it was queued at
+     */
+    struct OpenEntry {
+        std::uint32_t cell;
+        std::uint32_t cost;
+    };
+
+    // A* and repair scratch, reused between calls
+    std::vector<Node> nodes;
+    std::vector<std::vector<OpenEntry>> buckets; // A* open list by extra estimate
+    std::uint32_t currentStamp = 0;
+    std::vector<std::size_t> changed;  // Cells read from the board's change log
+    std::vector<std::size_t> frontier; // BFS queue and repair lists
+
+    /**
+     * @brief Bring a field up to date with the board and return it
+     * @param target Kind of target
+     * @return const std::vector<std::uint32_t>& Distances
+     */
+    const std::vector<std::uint32_t>& getField(Target target);
+
+    /**
+     * @brief Build a field from scratch with a multi-source BFS
+     */
+    void rebuild(Target target, Field& field);
+
+    /**
+     * @brief Repair a field after some squares changed
+     * @param target Kind of target
+     * @param field Field whose distances predate the changes
+     * @param cells Squares that changed (may repeat)
+     *
+     * Distances that may have grown are found first and cleared, then
+     * every cleared or changed square is filled again from its
+     * neighbours, shortest first.
+     */
+    void repair(Target target, Field& field, const std::vector<std::size_t>& cells);
+
+    /**
+     * @brief Check whether a square is a target
+     */
+    bool isTarget(Target target, std::size_t cell) const;
+
+    /**
+     * @brief Check whether a route may pass through a square
+     */
+    bool isPassable(std::size_t cell) const;
+
+    /**
+     * @brief Start a new search: invalidate all scratch entries at once
+     */
+    void nextStamp();
+
+    /**
+     * @brief Check whether a goal is cut off from the start by a small pocket
+     * @param goal Destination square
+     * @param start Start square
+     * @return bool True if every square reachable from the goal was visited
+     *         without meeting the start (at most POCKET_LIMIT squares are tried)
+     */
+    bool isSealedOff(std::size_t goal, std::size_t start);
+
+    /**
+     * @brief Queue a square in the A* open list
+     * @param estimate Bucket (extra steps over the Manhattan distance)
+     * @param cell Square
+     * @param cost Steps from the start it was reached in
+     */
+    void pushOpen(std::size_t estimate, std::uint32_t cell, std::uint32_t cost);
+
+    /**
+     * @brief Visit the in-bounds four-way neighbours of a square
+     * @param cell Row-major square index
+     * @param visit Called with each neighbour's index
+     */
+    template <typename Visit>
+    void forEachNeighbour(std::size_t cell, Visit visit) const {
+        const int x = static_cast<int>(cell % static_cast<std::size_t>(width));
+        if (cell >= static_cast<std::size_t>(width)) visit(cell - width);
+        if (cell + width < cellCount) visit(cell + width);
+        if (x > 0) visit(cell - 1);
+        if (x + 1 < width) visit(cell + 1);
+    }
+};
+
+#endif // PATHFINDER_H
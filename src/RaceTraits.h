@@ -0,0 +1,90 @@
+/**
+ * @file RaceTraits.h
+ * @brief Compile-time table of every race's stats and combat rules
+ */
+
+#ifndef RACETRAITS_H
+#define RACETRAITS_H
+
+#include "Character.h"
+
+/**
+ * @brief Number of races in the Race enum
+ */
+constexpr int RACE_COUNT = 5;
+
+/**
+ * @struct DefenceRule
+ * @brief A race's processSuccessfulDefence() outcome as a formula
+ *
+ * damage = fixed + floor(effectRoll * span) + quarter * max(0, (attackerAttack - defence) / 4)
+ */
+struct DefenceRule {
+    int fixed;   ///< Constant damage (-1 heals)
+    int span;    ///< Number of equally likely random extra damage values (0 for none)
+    int quarter; ///< 1 to add a quarter of the attack/defence difference
+
+    /**
+     * @brief Evaluate the rule
+     * @param attackerAttack Attacker's attack value
+     * @param defenderDefence Defender's defence value
+     * @param effectRoll Uniform random value in [0, 1)
+     * @return int Damage to the defender (negative heals)
+     */
+    constexpr int apply(int attackerAttack, int defenderDefence, double effectRoll) const {
+        const int quarterDamage = (attackerAttack - defenderDefence) / 4;
+        return fixed + static_cast<int>(effectRoll * span) + quarter * (quarterDamage > 0 ? quarterDamage : 0);
+    }
+};
+
+/**
+ * @struct RaceTraits
+ * @brief Everything that distinguishes one race in combat
+ *
+ * The race classes read their stats and rules from here, so the dynamic
+ * Character API and the specialized combat paths cannot drift apart.
+ * Per-time arrays are indexed by isDaytime (0 = night, 1 = day).
+ */
+struct RaceTraits {
+    const char* name;
+    int attack;
+    int defence;
+    int health;
+    int strength;
+    double attackChance[2];
+    double defenceChance[2];
+    DefenceRule defenceRule[2];
+    bool itemsAffectCombat; ///< False if getAttack()/getDefence() ignore item modifiers
+};
+
+/**
+ * @brief Traits of every race, indexed by Race
+ */
+constexpr RaceTraits RACE_TRAITS[RACE_COUNT] = {
+    // Human: reliable attacks, defences never cause damage
+    {"Human", 30, 20, 60, 100, {2.0 / 3.0, 2.0 / 3.0}, {1.0 / 2.0, 1.0 / 2.0},
+     {{0, 0, 0}, {0, 0, 0}}, true},
+    // Elf: attacks always land, defences heal 1
+    {"Elf", 40, 10, 40, 70, {1.0, 1.0}, {1.0 / 4.0, 1.0 / 4.0},
+     {{-1, 0, 0}, {-1, 0, 0}}, true},
+    // Dwarf: good at both, defences never cause damage
+    {"Dwarf", 30, 20, 50, 130, {2.0 / 3.0, 2.0 / 3.0}, {2.0 / 3.0, 2.0 / 3.0},
+     {{0, 0, 0}, {0, 0, 0}}, true},
+    // Hobbit: weak attacks, defences cause 0-5 random damage
+    {"Hobbit", 25, 20, 70, 85, {1.0 / 3.0, 1.0 / 3.0}, {2.0 / 3.0, 2.0 / 3.0},
+     {{0, 6, 0}, {0, 6, 0}}, true},
+    // Orc: poor by day (defences take a quarter of adjusted damage), strong at night (defences heal 1)
+    {"Orc", 25, 10, 50, 130, {1.0, 1.0 / 4.0}, {1.0 / 2.0, 1.0 / 4.0},
+     {{-1, 0, 0}, {0, 0, 1}}, false},
+};
+
+/**
+ * @brief Look up a race's traits
+ * @param race Race to look up
+ * @return const RaceTraits& Table entry
+ */
+constexpr const RaceTraits& raceTraits(Race race) {
+    return RACE_TRAITS[static_cast<int>(race)];
+}
+
+#endif // RACETRAITS_H
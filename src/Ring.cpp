@@ -16,6 +16,10 @@ std::string Ring::getCategory() const {
     return "Ring";
 }
 
+ItemCategory Ring::getCategoryId() const {
+    return ItemCategory::Ring;
+}
+
 int Ring::getWeight() const {
     return weight;
 }
@@ -0,0 +1,12 @@
+/**
+ * @file Rng.cpp
+ * @brief Implementation of Rng seeding helpers
+ */
+
+#include "Rng.h"
+#include <random>
+
+Rng Rng::fromEntropy() {
+    std::random_device rd;
+    return Rng((static_cast<std::uint64_t>(rd()) << 32) | rd());
+}
@@ -0,0 +1,163 @@
+/**
+ * @file Rng.h
+ * @brief Small-state, seedable and splittable random generator (xoshiro256**)
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @class Rng
+ * @brief Sequential random generator owned and passed explicitly by its users
+ *
+ * There are no shared or hidden generators in the engine: each Game owns
+ * one Rng and hands independent streams to its board and combat system
+ * with split(). Equal seeds replay identically, and games running on
+ * different threads share no state.
+ *
+ * The generator is xoshiro256** with 32 bytes of state. It satisfies
+ * UniformRandomBitGenerator, so it also works with the <random>
+ * distributions.
+ */
+class Rng {
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Constructor for Rng
+     * @param seed Any 64-bit value; expanded to the full state with SplitMix64
+     */
+    explicit Rng(std::uint64_t seed) {
+        for (std::uint64_t& word : state) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            word = mix(seed);
+        }
+    }
+
+    /**
+     * @brief Restore a generator saved with getState()
+     * @param words The four state words
+     * @return Rng Generator continuing exactly where the saved one was
+     */
+    static Rng fromState(const std::array<std::uint64_t, 4>& words) {
+        Rng restored(0);
+        for (int i = 0; i < 4; ++i) restored.state[i] = words[i];
+        return restored;
+    }
+
+    /**
+     * @brief Get the full generator state (for snapshots)
+     * @return std::array<std::uint64_t, 4> State words
+     */
+    std::array<std::uint64_t, 4> getState() const {
+        return {state[0], state[1], state[2], state[3]};
+    }
+
+    /**
+     * @brief Create a generator seeded from std::random_device
+     * @return Rng Non-reproducible generator
+     */
+    static Rng fromEntropy();
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    /**
+     * @brief Generate the next 64-bit value
+     * @return std::uint64_t Uniform value
+     */
+    result_type operator()() {
+        const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Generate a double in [0, 1)
+     * @return double Uniform value with 53 random bits
+     */
+    double nextUnit() {
+        return static_cast<double>((*this)() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * @brief Generate an integer in [0, bound)
+     * @param bound Exclusive upper bound (must be > 0)
+     * @return std::uint32_t Uniform value (multiply-shift, negligible bias)
+     */
+    std::uint32_t nextBelow(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32);
+    }
+
+    /**
+     * @brief Check if a probability-based action succeeds
+     * @param probability Success probability (0.0 to 1.0)
+     * @return bool True if a uniform [0, 1) draw is <= probability
+     */
+    bool chance(double probability) {
+        return nextUnit() <= probability;
+    }
+
+    /**
+     * @brief Split off an independent generator
+     * @return Rng Generator continuing from this one's current position
+     *
+     * This generator then jumps 2^128 steps ahead, so the two streams
+     * never overlap. The result depends only on the seed and the calls
+     * made so far.
+     */
+    Rng split() {
+        Rng child = *this;
+        jump();
+        return child;
+    }
+
+private:
+    std::uint64_t state[4];
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    static std::uint64_t mix(std::uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Advance the state by 2^128 steps
+     */
+    void jump() {
+        static constexpr std::uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                                 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+        std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (std::uint64_t word : JUMP) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & (std::uint64_t(1) << bit)) {
+                    s0 ^= state[0];
+                    s1 ^= state[1];
+                    s2 ^= state[2];
+                    s3 ^= state[3];
+                }
+                (*this)();
+            }
+        }
+        state[0] = s0;
+        state[1] = s1;
+        state[2] = s2;
+        state[3] = s3;
+    }
+};
+
+#endif // RNG_H
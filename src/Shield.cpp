@@ -16,6 +16,10 @@ std::string Shield::getCategory() const {
     return "Shield";
 }
 
+ItemCategory Shield::getCategoryId() const {
+    return ItemCategory::Shield;
+}
+
 int Shield::getWeight() const {
     return weight;
 }
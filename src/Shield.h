@@ -34,6 +34,7 @@ public:
 
     std::string getName() const override;
     std::string getCategory() const override;
+    ItemCategory getCategoryId() const override;
     int getWeight() const override;
     int getAttackMod() const override;
     int getDefenceMod() const override;
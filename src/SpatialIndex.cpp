@@ -0,0 +1,284 @@
+/**
+ * @file SpatialIndex.cpp
+ * @brief Implementation of SpatialIndex class
+ */
+
+#include "SpatialIndex.h"
+#include "BoardOccupancy.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+namespace {
+
+/**
+ * @brief Manhattan distance from a point to the nearest cell of a rectangle
+ */
+long distanceToRect(int x, int y, int left, int top, int right, int bottom) {
+    const long dx = x < left ? left - x : (x > right ? x - right : 0);
+    const long dy = y < top ? top - y : (y > bottom ? y - bottom : 0);
+    return dx + dy;
+}
+
+/**
+ * @brief Read up to 64 bits of a bitset starting at any bit position
+ */
+std::uint64_t bitsFrom(const std::vector<std::uint64_t>& bits, std::size_t start) {
+    const std::size_t word = start >> 6;
+    const unsigned offset = static_cast<unsigned>(start & 63);
+    std::uint64_t value = bits[word] >> offset;
+    if (offset != 0 && word + 1 < bits.size()) {
+        value |= bits[word + 1] << (64 - offset);
+    }
+    return value;
+}
+
+} // namespace
+
+SpatialIndex::SpatialIndex(int gridWidth, int gridHeight)
+    : width(std::max(gridWidth, 0)), height(std::max(gridHeight, 0)),
+    tileColumns((width + TILE_SIZE - 1) / TILE_SIZE), tileRows((height + TILE_SIZE - 1) / TILE_SIZE),
+    tiles(static_cast<std::size_t>(tileColumns) * static_cast<std::size_t>(tileRows), 0) {
+    if (tiles.empty()) {
+        return; // Nothing to index; every query comes back empty
+    }
+
+    // Halve both sides per level until a single root node remains
+    int columns = tileColumns;
+    int rows = tileRows;
+    int span = TILE_SIZE;
+    while (true) {
+        levels.push_back({columns, rows, span, std::vector<std::uint32_t>(
+                              static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows), 0)});
+        if (columns == 1 && rows == 1) break;
+        columns = (columns + 1) / 2;
+        rows = (rows + 1) / 2;
+        span *= 2;
+    }
+}
+
+void SpatialIndex::add(std::size_t cell) {
+    const int x = static_cast<int>(cell % static_cast<std::size_t>(width));
+    const int y = static_cast<int>(cell / static_cast<std::size_t>(width));
+    std::uint64_t& mask = tiles[static_cast<std::size_t>(y / TILE_SIZE) * tileColumns + x / TILE_SIZE];
+    const std::uint64_t bit = std::uint64_t(1) << ((y % TILE_SIZE) * TILE_SIZE + x % TILE_SIZE);
+    if (!(mask & bit)) {
+        mask |= bit;
+        adjustCounts(x / TILE_SIZE, y / TILE_SIZE, 1);
+    }
+}
+
+void SpatialIndex::remove(std::size_t cell) {
+    const int x = static_cast<int>(cell % static_cast<std::size_t>(width));
+    const int y = static_cast<int>(cell / static_cast<std::size_t>(width));
+    std::uint64_t& mask = tiles[static_cast<std::size_t>(y / TILE_SIZE) * tileColumns + x / TILE_SIZE];
+    const std::uint64_t bit = std::uint64_t(1) << ((y % TILE_SIZE) * TILE_SIZE + x % TILE_SIZE);
+    if (mask & bit) {
+        mask &= ~bit;
+        adjustCounts(x / TILE_SIZE, y / TILE_SIZE, -1);
+    }
+}
+
+void SpatialIndex::adjustCounts(int tileX, int tileY, int delta) {
+    for (Level& level : levels) {
+        level.counts[static_cast<std::size_t>(tileY) * level.columns + tileX] += delta;
+        tileX /= 2;
+        tileY /= 2;
+    }
+}
+
+/**
+ * @brief Rebuild the whole index from a row-major bitset
+ * @param bits Bit i of word w is cell w * 64 + i
+ *
+ * Pseudo-code:
+ * 1. For every grid row, cut the row's bits into 8-cell pieces and place
+ *    each piece in its tile's mask (one shifted read per tile row)
+ * 2. Count each tile's bits into level 0
+ * 3. Sum each level's 2x2 blocks into the level above
+ */
+void SpatialIndex::rebuild(const std::vector<std::uint64_t>& bits) {
+    std::fill(tiles.begin(), tiles.end(), 0);
+    for (int y = 0; y < height; ++y) {
+        const std::size_t rowStart = static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+        const unsigned shift = static_cast<unsigned>((y % TILE_SIZE) * TILE_SIZE);
+        std::uint64_t* tileRow = &tiles[static_cast<std::size_t>(y / TILE_SIZE) * tileColumns];
+        for (int tileX = 0; tileX < tileColumns; ++tileX) {
+            const int cellsInTile = std::min(TILE_SIZE, width - tileX * TILE_SIZE);
+            const std::uint64_t piece = bitsFrom(bits, rowStart + static_cast<std::size_t>(tileX) * TILE_SIZE) &
+                                        ((std::uint64_t(1) << cellsInTile) - 1);
+            tileRow[tileX] |= piece << shift;
+        }
+    }
+
+    if (levels.empty()) {
+        return;
+    }
+    for (std::size_t i = 0; i < tiles.size(); ++i) {
+        levels[0].counts[i] = static_cast<std::uint32_t>(BoardOccupancy::popcount(tiles[i]));
+    }
+    for (std::size_t l = 1; l < levels.size(); ++l) {
+        const Level& below = levels[l - 1];
+        Level& level = levels[l];
+        std::fill(level.counts.begin(), level.counts.end(), 0);
+        for (int row = 0; row < below.rows; ++row) {
+            for (int column = 0; column < below.columns; ++column) {
+                level.counts[static_cast<std::size_t>(row / 2) * level.columns + column / 2] +=
+                    below.counts[static_cast<std::size_t>(row) * below.columns + column];
+            }
+        }
+    }
+}
+
+std::size_t SpatialIndex::count() const {
+    return levels.empty() ? 0 : levels.back().counts[0];
+}
+
+std::uint32_t SpatialIndex::nodeCount(int level, int nodeX, int nodeY) const {
+    const Level& layer = levels[static_cast<std::size_t>(level)];
+    if (nodeX >= layer.columns || nodeY >= layer.rows) {
+        return 0;
+    }
+    return layer.counts[static_cast<std::size_t>(nodeY) * layer.columns + nodeX];
+}
+
+/**
+ * @brief Find the set cells closest to a position (Manhattan distance)
+ * @param x X coordinate to search from
+ * @param y Y coordinate to search from
+ * @param k Maximum number of cells to return
+ * @return std::vector<std::pair<int, int>> Up to k cells, nearest first
+ *
+ * Pseudo-code:
+ * 1. Queue the root with its distance lower bound
+ * 2. Pop the closest entry: a cell is the next answer; a tile queues its
+ *    set cells at their exact distance; any other node queues its
+ *    occupied children at their lower bounds
+ * 3. At equal distance, regions are opened before cells are reported and
+ *    cells come out in row-major order, so ties match a grid scan
+ */
+std::vector<std::pair<int, int>> SpatialIndex::findNearest(int x, int y, std::size_t k) const {
+    std::vector<std::pair<int, int>> found;
+    if (k == 0 || count() == 0) {
+        return found;
+    }
+
+    // (distance, is a cell, y, x, level); level is unused for cells
+    using Entry = std::tuple<long, bool, int, int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    const int root = static_cast<int>(levels.size()) - 1;
+    queue.emplace(distanceToRect(x, y, 0, 0, width - 1, height - 1), false, 0, 0, root);
+
+    while (!queue.empty() && found.size() < k) {
+        const auto [distance, isCell, nodeY, nodeX, level] = queue.top();
+        queue.pop();
+        (void)distance;
+
+        if (isCell) {
+            found.emplace_back(nodeX, nodeY);
+        } else if (level == 0) {
+            std::uint64_t mask = tiles[static_cast<std::size_t>(nodeY) * tileColumns + nodeX];
+            while (mask) {
+                const int bit = BoardOccupancy::lowestBit(mask);
+                mask &= mask - 1;
+                const int cellX = nodeX * TILE_SIZE + bit % TILE_SIZE;
+                const int cellY = nodeY * TILE_SIZE + bit / TILE_SIZE;
+                queue.emplace(std::abs(cellX - x) + std::abs(cellY - y), true, cellY, cellX, 0);
+            }
+        } else {
+            const int span = levels[static_cast<std::size_t>(level) - 1].span;
+            for (int childY = nodeY * 2; childY <= nodeY * 2 + 1; ++childY) {
+                for (int childX = nodeX * 2; childX <= nodeX * 2 + 1; ++childX) {
+                    if (nodeCount(level - 1, childX, childY) == 0) continue;
+                    const int left = childX * span;
+                    const int top = childY * span;
+                    queue.emplace(distanceToRect(x, y, left, top, left + span - 1, top + span - 1),
+                                  false, childY, childX, level - 1);
+                }
+            }
+        }
+    }
+    return found;
+}
+
+std::vector<std::pair<int, int>> SpatialIndex::findInRange(int x0, int y0, int x1, int y1) const {
+    std::vector<std::pair<int, int>> found;
+    if (!levels.empty()) {
+        collectInRange(static_cast<int>(levels.size()) - 1, 0, 0, x0, y0, x1, y1, found);
+    }
+    return found;
+}
+
+void SpatialIndex::collectInRange(int level, int nodeX, int nodeY, int x0, int y0, int x1, int y1,
+                                  std::vector<std::pair<int, int>>& out) const {
+    const int span = levels[static_cast<std::size_t>(level)].span;
+    const int left = nodeX * span;
+    const int top = nodeY * span;
+    if (nodeCount(level, nodeX, nodeY) == 0 || left > x1 || top > y1 ||
+        left + span - 1 < x0 || top + span - 1 < y0) {
+        return;
+    }
+
+    if (level == 0) {
+        std::uint64_t mask = tiles[static_cast<std::size_t>(nodeY) * tileColumns + nodeX];
+        while (mask) {
+            const int bit = BoardOccupancy::lowestBit(mask);
+            mask &= mask - 1;
+            const int cellX = left + bit % TILE_SIZE;
+            const int cellY = top + bit / TILE_SIZE;
+            if (cellX >= x0 && cellX <= x1 && cellY >= y0 && cellY <= y1) {
+                out.emplace_back(cellX, cellY);
+            }
+        }
+        return;
+    }
+
+    for (int childY = nodeY * 2; childY <= nodeY * 2 + 1; ++childY) {
+        for (int childX = nodeX * 2; childX <= nodeX * 2 + 1; ++childX) {
+            collectInRange(level - 1, childX, childY, x0, y0, x1, y1, out);
+        }
+    }
+}
+
+std::size_t SpatialIndex::countInRange(int x0, int y0, int x1, int y1) const {
+    if (levels.empty()) {
+        return 0;
+    }
+    return countNode(static_cast<int>(levels.size()) - 1, 0, 0, x0, y0, x1, y1);
+}
+
+std::size_t SpatialIndex::countNode(int level, int nodeX, int nodeY, int x0, int y0, int x1, int y1) const {
+    const int span = levels[static_cast<std::size_t>(level)].span;
+    const int left = nodeX * span;
+    const int top = nodeY * span;
+    const std::uint32_t nodeTotal = nodeCount(level, nodeX, nodeY);
+    if (nodeTotal == 0 || left > x1 || top > y1 || left + span - 1 < x0 || top + span - 1 < y0) {
+        return 0;
+    }
+    if (left >= x0 && top >= y0 && left + span - 1 <= x1 && top + span - 1 <= y1) {
+        return nodeTotal; // Entirely inside: no need to look further down
+    }
+
+    if (level == 0) {
+        std::size_t total = 0;
+        std::uint64_t mask = tiles[static_cast<std::size_t>(nodeY) * tileColumns + nodeX];
+        while (mask) {
+            const int bit = BoardOccupancy::lowestBit(mask);
+            mask &= mask - 1;
+            const int cellX = left + bit % TILE_SIZE;
+            const int cellY = top + bit / TILE_SIZE;
+            total += (cellX >= x0 && cellX <= x1 && cellY >= y0 && cellY <= y1) ? 1 : 0;
+        }
+        return total;
+    }
+
+    std::size_t total = 0;
+    for (int childY = nodeY * 2; childY <= nodeY * 2 + 1; ++childY) {
+        for (int childX = nodeX * 2; childX <= nodeX * 2 + 1; ++childX) {
+            total += countNode(level - 1, childX, childY, x0, y0, x1, y1);
+        }
+    }
+    return total;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file SpatialIndex.h
+ * @brief Occupancy pyramid answering nearest and range queries over a grid
+ */
+
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class SpatialIndex
+ * @brief Tracks which cells of a grid are set, summarized by region
+ *
+ * The grid is cut into 8x8 tiles, each stored as one 64-bit mask. Above
+ * the tiles sits a pyramid of counts: every level halves both sides and
+ * each node holds the number of set cells below it, up to a single root.
+ * A board of N cells has about log4(N / 64) levels, so add() and remove()
+ * touch one mask and one count per level, and queries skip every empty
+ * region in a single step.
+ *
+ * Nearest queries walk the pyramid best-first by the Manhattan distance
+ * to each region; range queries descend only into occupied regions that
+ * overlap the rectangle. Ties are reported in row-major order, matching
+ * a plain scan of the grid.
+ */
+class SpatialIndex {
+public:
+    /**
+     * @brief Cells per side of a leaf tile (one 64-bit mask)
+     */
+    static constexpr int TILE_SIZE = 8;
+
+    /**
+     * @brief Constructor for SpatialIndex
+     * @param gridWidth Width of the grid in cells
+     * @param gridHeight Height of the grid in cells
+     */
+    SpatialIndex(int gridWidth, int gridHeight);
+
+    /**
+     * @brief Mark a cell as set
+     * @param cell Row-major cell index; must not already be set
+     */
+    void add(std::size_t cell);
+
+    /**
+     * @brief Mark a cell as clear
+     * @param cell Row-major cell index; must currently be set
+     */
+    void remove(std::size_t cell);
+
+    /**
+     * @brief Rebuild the whole index from a row-major bitset
+     * @param bits Bit i of word w is cell w * 64 + i
+     */
+    void rebuild(const std::vector<std::uint64_t>& bits);
+
+    /**
+     * @brief Get the number of set cells
+     * @return std::size_t Set cells on the grid
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Find the set cells closest to a position (Manhattan distance)
+     * @param x X coordinate to search from
+     * @param y Y coordinate to search from
+     * @param k Maximum number of cells to return
+     * @return std::vector<std::pair<int, int>> (x, y) of up to k cells, nearest first
+     */
+    std::vector<std::pair<int, int>> findNearest(int x, int y, std::size_t k) const;
+
+    /**
+     * @brief Find every set cell inside a rectangle
+     * @param x0 Left column (inclusive)
+     * @param y0 Top row (inclusive)
+     * @param x1 Right column (inclusive)
+     * @param y1 Bottom row (inclusive)
+     * @return std::vector<std::pair<int, int>> (x, y) of the cells, grouped by tile
+     */
+    std::vector<std::pair<int, int>> findInRange(int x0, int y0, int x1, int y1) const;
+
+    /**
+     * @brief Count the set cells inside a rectangle
+     * @param x0 Left column (inclusive)
+     * @param y0 Top row (inclusive)
+     * @param x1 Right column (inclusive)
+     * @param y1 Bottom row (inclusive)
+     * @return std::size_t Set cells in the rectangle
+     *
+     * Regions entirely inside the rectangle are counted without descending.
+     */
+    std::size_t countInRange(int x0, int y0, int x1, int y1) const;
+
+private:
+    /**
+     * @struct Level
+     * @brief One layer of the count pyramid
+     */
+    struct Level {
+        int columns;                        ///< Nodes across
+        int rows;                           ///< Nodes down
+        int span;                           ///< Cells per node side
+        std::vector<std::uint32_t> counts;  ///< Set cells per node, row-major
+    };
+
+    int width;
+    int height;
+    int tileColumns;
+    int tileRows;
+    std::vector<std::uint64_t> tiles; // Bit (row * 8 + column) of each 8x8 tile
+    std::vector<Level> levels;        // levels[0] counts tiles; the last has one node
+
+    /**
+     * @brief Add a signed amount to the counts above a tile
+     * @param tileX Tile column
+     * @param tileY Tile row
+     * @param delta +1 or -1
+     */
+    void adjustCounts(int tileX, int tileY, int delta);
+
+    /**
+     * @brief Get the set cells below a node
+     * @param level Pyramid level (0 = tiles)
+     * @param nodeX Node column at that level
+     * @param nodeY Node row at that level
+     * @return std::uint32_t Count, or 0 for a child past the level's edge
+     */
+    std::uint32_t nodeCount(int level, int nodeX, int nodeY) const;
+
+    /**
+     * @brief Append the set cells of a node that lie in a rectangle
+     */
+    void collectInRange(int level, int nodeX, int nodeY, int x0, int y0, int x1, int y1,
+                        std::vector<std::pair<int, int>>& out) const;
+
+    /**
+     * @brief Count the set cells of a node that lie in a rectangle
+     */
+    std::size_t countNode(int level, int nodeX, int nodeY, int x0, int y0, int x1, int y1) const;
+};
+
+#endif // SPATIALINDEX_H
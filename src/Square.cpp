@@ -4,61 +4,47 @@
  */
 
 #include "Square.h"
+#include "RaceTraits.h"
 
-Square::Square() : isEmpty(true) {
+Square::Square() : item(ItemCatalog::NONE), enemy(EnemyRegistry::NONE) {
     // Initialize as empty square
 }
 
 bool Square::getIsEmpty() const {
-    return isEmpty && !item && !enemy;
-}
-
-void Square::setItem(std::shared_ptr<Item> newItem) {
-    item = newItem;
-    isEmpty = false;
+    return item == ItemCatalog::NONE && enemy == EnemyRegistry::NONE;
 }
 
 std::shared_ptr<Item> Square::getItem() const {
-    return item;
-}
-
-void Square::removeItem() {
-    item.reset();
-    // Check if square becomes empty
-    if (!enemy) {
-        isEmpty = true;
-    }
+    return ItemCatalog::share(item);
 }
 
-void Square::setEnemy(std::shared_ptr<Character> newEnemy) {
-    enemy = newEnemy;
-    isEmpty = false;
+ItemId Square::getItemId() const {
+    return item;
 }
 
-std::shared_ptr<Character> Square::getEnemy() const {
+EnemyHandle Square::getEnemy() const {
     return enemy;
 }
 
-void Square::removeEnemy() {
-    enemy.reset();
-    // Check if square becomes empty
-    if (!item) {
-        isEmpty = true;
-    }
+bool Square::hasEnemy() const {
+    return enemy != EnemyRegistry::NONE;
 }
 
-std::string Square::getDescription() const {
+std::string Square::getDescription(const EnemyRegistry& enemies) const {
     std::string description = "This location contains: ";
 
-    if (isEmpty) {
+    if (getIsEmpty()) {
         description += "nothing";
     } else {
-        if (item) {
-            description += "a " + item->getName();
+        const bool hasItem = item != ItemCatalog::NONE;
+        if (hasItem) {
+            description += "a " + std::string(ItemCatalog::getEntry(item).name);
         }
-        if (enemy) {
-            if (item) description += " and ";
-            description += "a " + enemy->getRace() + " enemy named " + enemy->getName();
+        if (enemy != EnemyRegistry::NONE) {
+            const Race race = enemies.getRace(enemy);
+            if (hasItem) description += " and ";
+            description += "a " + std::string(raceTraits(race).name) + " enemy named " +
+                           EnemyRegistry::getName(race);
         }
     }
 
@@ -7,21 +7,32 @@
 #define SQUARE_H
 
 #include <memory>
+#include <string>
 #include "Item.h"
+#include "ItemCatalog.h"
 #include "Character.h"
+#include "EnemyRegistry.h"
 
 /**
  * @class Square
  * @brief Represents a single location on the game board
  *
- * Each square can contain an item, an enemy, or be empty.
- * Managed by smart pointers as required by project specification.
+ * Each square can contain an item, an enemy, or be empty. Items are
+ * stored as ItemCatalog ids, so an item on the board costs one byte, and
+ * enemies as handles into the EnemyRegistry of the occupancy layer.
+ * Stored by value in the Board's contiguous grid, eight bytes each.
+ *
+ * A square does not know where it lies: its contents change only through
+ * the BoardOccupancy layer of its grid (usually via Board), which knows
+ * the cell index and keeps the packed arrays in sync.
  */
 class Square {
 private:
-    std::shared_ptr<Item> item;
-    std::shared_ptr<Character> enemy;
-    bool isEmpty;
+    ItemId item;
+    EnemyHandle enemy;
+
+    friend class BoardOccupancy; // Changes contents and mirrors them in its arrays
+    friend class Board;          // Puts enemies registered in bulk on their squares
 
 public:
     /**
@@ -35,45 +46,36 @@ public:
      */
     bool getIsEmpty() const;
 
-    /**
-     * @brief Set item on this square
-     * @param newItem Shared pointer to the item
-     */
-    void setItem(std::shared_ptr<Item> newItem);
-
     /**
      * @brief Get item from this square
-     * @return std::shared_ptr<Item> Pointer to item or nullptr
+     * @return std::shared_ptr<Item> Non-owning pointer to the catalog item, or nullptr
      */
     std::shared_ptr<Item> getItem() const;
 
     /**
-     * @brief Remove item from this square
-     */
-    void removeItem();
-
-    /**
-     * @brief Set enemy on this square
-     * @param newEnemy Shared pointer to the enemy character
+     * @brief Get the type id of the item on this square
+     * @return ItemId Catalog item id, or ItemCatalog::NONE
      */
-    void setEnemy(std::shared_ptr<Character> newEnemy);
+    ItemId getItemId() const;
 
     /**
-     * @brief Get enemy from this square
-     * @return std::shared_ptr<Character> Pointer to enemy or nullptr
+     * @brief Get the enemy on this square
+     * @return EnemyHandle Handle into the occupancy layer's registry, or EnemyRegistry::NONE
      */
-    std::shared_ptr<Character> getEnemy() const;
+    EnemyHandle getEnemy() const;
 
     /**
-     * @brief Remove enemy from this square
+     * @brief Check whether an enemy stands on this square
+     * @return bool True if the square holds an enemy
      */
-    void removeEnemy();
+    bool hasEnemy() const;
 
     /**
      * @brief Get description of square contents
+     * @param enemies Registry of the square's occupancy layer
      * @return std::string Formatted description
      */
-    std::string getDescription() const;
+    std::string getDescription(const EnemyRegistry& enemies) const;
 };
 
 #endif // SQUARE_H
@@ -0,0 +1,123 @@
+/**
+ * @file TextRenderer.cpp
+ * @brief Implementation of TextRenderer class
+ */
+
+#include "TextRenderer.h"
+#include "Game.h"
+#include "ItemCatalog.h"
+#include "RaceTraits.h"
+
+namespace {
+
+std::string itemName(std::uint8_t item) {
+    return std::string(ItemCatalog::getEntry(item).name);
+}
+
+std::string raceName(std::uint8_t race) {
+    return raceTraits(static_cast<Race>(race)).name;
+}
+
+std::string direction(std::uint8_t verb) {
+    return std::string(verbName(static_cast<Verb>(verb)));
+}
+
+} // namespace
+
+std::string TextRenderer::render(const CommandResult& result, const Game& game) {
+    std::string message;
+    for (const CommandEvent& event : result) {
+        append(message, event, game);
+    }
+    return message;
+}
+
+void TextRenderer::append(std::string& out, const CommandEvent& event, const Game& game) {
+    switch (event.code) {
+    case GameEvent::Moved:
+        out += "Moved " + direction(event.subject) + ". " + game.getBoard().getCurrentLocationDescription();
+        break;
+    case GameEvent::OutOfBounds:
+        out += "Cannot move " + direction(event.subject) + " - out of bounds.";
+        break;
+    case GameEvent::LocationShown:
+        out += game.getBoard().getCurrentLocationDescription();
+        break;
+    case GameEvent::NoItemHere:
+        out += "No item here to pick up.";
+        break;
+    case GameEvent::PickedUp:
+        out += "Picked up: " + itemName(event.subject);
+        break;
+    case GameEvent::TooHeavy:
+        out += "Cannot pick up " + itemName(event.subject) + " - too heavy or category limit reached.";
+        break;
+    case GameEvent::SquareOccupied:
+        out += "Cannot drop item here - square already contains an item.";
+        break;
+    case GameEvent::InventoryEmpty:
+        out += "Your inventory is empty - nothing to drop.";
+        break;
+    case GameEvent::DropChoices: {
+        const auto& items = game.getPlayer().getInventory().getItems();
+        out += "Your inventory:\n";
+        for (size_t i = 0; i < items.size(); ++i) {
+            out += "  " + std::to_string(i + 1) + ". " + ItemCatalog::get(items[i]).getDescription() + "\n";
+        }
+        out += "Which item do you want to drop? (drop <number>, drop <item name>, or 0 to cancel)";
+        break;
+    }
+    case GameEvent::DropCancelled:
+        out += "Drop cancelled.";
+        break;
+    case GameEvent::InvalidChoice:
+        out += "Invalid choice - select a number from the list or an item you carry.";
+        break;
+    case GameEvent::Dropped:
+        out += "Dropped: " + itemName(event.subject);
+        break;
+    case GameEvent::DropFailed:
+        out += "Failed to drop item from inventory.";
+        break;
+    case GameEvent::NoEnemy:
+        out += "No enemy here to attack.";
+        break;
+    case GameEvent::CombatStarted:
+        out += "COMBAT BEGINS!\n\nYOUR ATTACK:\n";
+        break;
+    case GameEvent::PlayerHit:
+        out += "You hit the " + raceName(event.subject) + "!\n";
+        out += "Enemy health: " + std::to_string(event.value) + "\n\nENEMY COUNTERATTACK:\n";
+        break;
+    case GameEvent::PlayerMissed:
+        out += "Your attack missed!\n\nENEMY COUNTERATTACK:\n";
+        break;
+    case GameEvent::EnemyDefeated:
+        out += "You defeated the " + raceName(event.subject) + "!\n";
+        out += "Gained " + std::to_string(event.value) + " gold.\n";
+        break;
+    case GameEvent::EnemyHit:
+        out += "The " + raceName(event.subject) + " hits you!\n";
+        out += "Your health: " + std::to_string(event.value) + "\n";
+        break;
+    case GameEvent::EnemyMissed:
+        out += "The " + raceName(event.subject) + "'s attack missed!\n";
+        break;
+    case GameEvent::PlayerDefeated:
+        out += "\nYOU HAVE BEEN DEFEATED! GAME OVER.\n";
+        break;
+    case GameEvent::InventoryShown:
+        out += game.getPlayer().getInventory().getInventorySummary();
+        out += "\nGold: " + std::to_string(event.value);
+        break;
+    case GameEvent::GameEnded:
+        out += "Game ended. Total gold collected: " + std::to_string(event.value);
+        break;
+    case GameEvent::UnknownCommand:
+        out += "Unknown command. Available commands: north, south, east, west, pick up, drop, attack, look, inventory, exit";
+        break;
+    case GameEvent::NotRunning:
+        out += "Game is not running. Please start a new game.";
+        break;
+    }
+}
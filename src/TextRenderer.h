@@ -0,0 +1,42 @@
+/**
+ * @file TextRenderer.h
+ * @brief Console text for structured command results
+ */
+
+#ifndef TEXTRENDERER_H
+#define TEXTRENDERER_H
+
+#include <string>
+#include "CommandResult.h"
+
+class Game;
+
+/**
+ * @class TextRenderer
+ * @brief Turns CommandResult events into the messages shown to a human player
+ *
+ * Rendering is a separate, optional stage: Game::execute() only records
+ * event codes, and bots can read those directly. Events that describe the
+ * current state (a look, the inventory, the drop choices) read it from the
+ * game, so render a result before issuing the next command.
+ */
+class TextRenderer {
+public:
+    /**
+     * @brief Render every event of a result
+     * @param result Result returned by Game::execute()
+     * @param game Game the command ran on
+     * @return std::string Message text
+     */
+    static std::string render(const CommandResult& result, const Game& game);
+
+    /**
+     * @brief Append the text of one event
+     * @param out String to append to
+     * @param event Event to render
+     * @param game Game the command ran on
+     */
+    static void append(std::string& out, const CommandEvent& event, const Game& game);
+};
+
+#endif // TEXTRENDERER_H
@@ -22,6 +22,10 @@ std::string Weapon::getCategory() const {
     return "Weapon";
 }
 
+ItemCategory Weapon::getCategoryId() const {
+    return ItemCategory::Weapon;
+}
+
 int Weapon::getWeight() const {
     return weight;
 }
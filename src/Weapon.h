@@ -33,6 +33,7 @@ public:
     // Item interface implementation
     std::string getName() const override;
     std::string getCategory() const override;
+    ItemCategory getCategoryId() const override;
     int getWeight() const override;
     int getAttackMod() const override;
     int getDefenceMod() const override;
@@ -0,0 +1,74 @@
+/**
+ * @file WorldFile.cpp
+ * @brief Implementation of WorldFile class
+ */
+
+#include "WorldFile.h"
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WORLDFILE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::shared_ptr<const WorldFile> WorldFile::open(const std::string& path) {
+    std::shared_ptr<WorldFile> world(new WorldFile());
+
+#ifdef WORLDFILE_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat info;
+    if (fstat(fd, &info) < 0 || static_cast<std::size_t>(info.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::runtime_error("World file is truncated: " + path);
+    }
+
+    // Read-only private mapping: pages come from the shared page cache and
+    // are never written, so every process mapping the file shares them
+    world->mappedBytes = static_cast<std::size_t>(info.st_size);
+    void* base = mmap(nullptr, world->mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + path);
+    }
+    world->mapping = base;
+    const char* bytes = static_cast<const char*>(base);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    const std::size_t size = static_cast<std::size_t>(in.tellg());
+    if (size < sizeof(SnapshotHeader)) {
+        throw std::runtime_error("World file is truncated: " + path);
+    }
+    world->copy.resize((size + 7) / 8);
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(world->copy.data()), static_cast<std::streamsize>(size));
+    world->mappedBytes = size;
+    const char* bytes = reinterpret_cast<const char*>(world->copy.data());
+#endif
+
+    // Header and cells are used in place; the layout is 8-byte aligned
+    world->header = reinterpret_cast<const SnapshotHeader*>(bytes);
+    GameSnapshot::checkHeader(*world->header);
+    if (world->header->fileBytes > world->mappedBytes) {
+        throw std::runtime_error("World file is truncated: " + path);
+    }
+    world->cells = reinterpret_cast<const CellRecord*>(bytes + world->header->cellsOffset);
+    return world;
+}
+
+WorldFile::~WorldFile() {
+#ifdef WORLDFILE_HAS_MMAP
+    if (mapping) {
+        munmap(mapping, mappedBytes);
+    }
+#endif
+}
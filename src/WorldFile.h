@@ -0,0 +1,79 @@
+/**
+ * @file WorldFile.h
+ * @brief Read-only memory mapping of a pre-built world (snapshot) file
+ */
+
+#ifndef WORLDFILE_H
+#define WORLDFILE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GameSnapshot.h"
+
+/**
+ * @class WorldFile
+ * @brief A GameSnapshot file mapped into memory as the source of a board's squares
+ *
+ * Opening a world costs one mmap() no matter how large it is: pages are
+ * read from the file on first touch, and because the mapping is read-only
+ * every process (and every Board in this process) that opens the same file
+ * shares one physical copy through the page cache. Boards never write to
+ * the mapping; a chunked board copies the chunks a session visits into
+ * its own squares and keeps changes there.
+ *
+ * On platforms without mmap the cells are read into memory instead.
+ */
+class WorldFile {
+public:
+    /**
+     * @brief Open and map a world file
+     * @param path File written by GameSnapshot::save()
+     * @return std::shared_ptr<const WorldFile> Mapping shared by every board using it
+     * @throws std::runtime_error if the file cannot be opened or is not a valid snapshot
+     */
+    static std::shared_ptr<const WorldFile> open(const std::string& path);
+
+    /**
+     * @brief Destructor - unmaps the file
+     */
+    ~WorldFile();
+
+    WorldFile(const WorldFile&) = delete;
+    WorldFile& operator=(const WorldFile&) = delete;
+
+    /**
+     * @brief Get the snapshot header
+     * @return const SnapshotHeader& Board size, player start, time of day and seed
+     */
+    const SnapshotHeader& getHeader() const { return *header; }
+
+    /**
+     * @brief Get the record of one square
+     * @param x X coordinate (0 <= x < width)
+     * @param y Y coordinate (0 <= y < height)
+     * @return const CellRecord& Saved contents of the square
+     */
+    const CellRecord& getCell(int x, int y) const {
+        return cells[static_cast<std::size_t>(y) * static_cast<std::size_t>(header->width) +
+                     static_cast<std::size_t>(x)];
+    }
+
+    /**
+     * @brief Check whether the file is mapped (as opposed to read into memory)
+     * @return bool True if backed by mmap
+     */
+    bool isMapped() const { return mapping != nullptr; }
+
+private:
+    WorldFile() = default;
+
+    void* mapping = nullptr;           // mmap base, or nullptr when read into memory
+    std::size_t mappedBytes = 0;
+    std::vector<std::uint64_t> copy;   // 8-byte aligned fallback storage
+    const SnapshotHeader* header = nullptr;
+    const CellRecord* cells = nullptr;
+};
+
+#endif // WORLDFILE_H
@@ -0,0 +1,79 @@
+# Game engine sources shared by the game executable and the tool projects.
+INCLUDEPATH += $$PWD
+
+SOURCES += \
+    $$PWD/Game.cpp \
+    $$PWD/Board.cpp \
+    $$PWD/Square.cpp \
+    $$PWD/Character.cpp \
+    $$PWD/Human.cpp \
+    $$PWD/Elf.cpp \
+    $$PWD/Dwarf.cpp \
+    $$PWD/Hobbit.cpp \
+    $$PWD/Orc.cpp \
+    $$PWD/Combat.cpp \
+    $$PWD/Item.cpp \
+    $$PWD/Weapon.cpp \
+    $$PWD/Armour.cpp \
+    $$PWD/Shield.cpp \
+    $$PWD/Ring.cpp \
+    $$PWD/Inventory.cpp \
+    $$PWD/ItemFactory.cpp \
+    $$PWD/BoardOccupancy.cpp \
+    $$PWD/CellRecord.cpp \
+    $$PWD/ChunkedWorld.cpp \
+    $$PWD/ItemCatalog.cpp \
+    $$PWD/CombatSimulator.cpp \
+    $$PWD/CombatSolver.cpp \
+    $$PWD/CombatBatch.cpp \
+    $$PWD/Rng.cpp \
+    $$PWD/TextRenderer.cpp \
+    $$PWD/GameSnapshot.cpp \
+    $$PWD/WorldFile.cpp \
+    $$PWD/CommandJournal.cpp \
+    $$PWD/SpatialIndex.cpp \
+    $$PWD/Pathfinder.cpp \
+    $$PWD/JobSystem.cpp \
+    $$PWD/EnemySimulation.cpp \
+    $$PWD/EnemyRegistry.cpp
+
+HEADERS += \
+    $$PWD/Game.h \
+    $$PWD/Board.h \
+    $$PWD/Square.h \
+    $$PWD/Character.h \
+    $$PWD/Human.h \
+    $$PWD/Elf.h \
+    $$PWD/Dwarf.h \
+    $$PWD/Hobbit.h \
+    $$PWD/Orc.h \
+    $$PWD/Combat.h \
+    $$PWD/Item.h \
+    $$PWD/Weapon.h \
+    $$PWD/Armour.h \
+    $$PWD/Shield.h \
+    $$PWD/Ring.h \
+    $$PWD/Inventory.h \
+    $$PWD/ItemFactory.h \
+    $$PWD/BoardOccupancy.h \
+    $$PWD/CounterRng.h \
+    $$PWD/CellRecord.h \
+    $$PWD/ChunkedWorld.h \
+    $$PWD/ItemCatalog.h \
+    $$PWD/CombatSimulator.h \
+    $$PWD/CombatSolver.h \
+    $$PWD/CombatBatch.h \
+    $$PWD/RaceTraits.h \
+    $$PWD/CombatKernel.h \
+    $$PWD/Rng.h \
+    $$PWD/CommandResult.h \
+    $$PWD/CommandParser.h \
+    $$PWD/TextRenderer.h \
+    $$PWD/GameSnapshot.h \
+    $$PWD/WorldFile.h \
+    $$PWD/CommandJournal.h \
+    $$PWD/SpatialIndex.h \
+    $$PWD/Pathfinder.h \
+    $$PWD/JobSystem.h \
+    $$PWD/EnemySimulation.h \
+    $$PWD/EnemyRegistry.h
@@ -6,6 +6,7 @@
  */
 
 #include "Game.h"
+#include "TextRenderer.h"
 #include <iostream>
 #include <string>
 #include <limits>
@@ -41,6 +42,11 @@ int main() {
             std::cout << "Enter your choice (1-5): ";
             std::cin >> characterChoice;
 
+            if (std::cin.eof()) {
+                // Input closed before a choice was made
+                return 0;
+            }
+
             if (std::cin.fail() || characterChoice < 1 || characterChoice > 5) {
                 std::cin.clear();
                 std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -74,14 +80,17 @@ int main() {
         std::string playerCommand;
         while (game.isGameRunning()) {
             std::cout << "> ";
-            std::getline(std::cin, playerCommand);
+            if (!std::getline(std::cin, playerCommand)) {
+                // Input closed (end of file or piped script finished)
+                break;
+            }
 
             if (playerCommand.empty()) continue;
 
             if (playerCommand == "help") {
                 std::cout << "\n=== Available Commands ===\n";
                 std::cout << "Movement: north, south, east, west (or n, s, e, w)\n";
-                std::cout << "Items: pick up (or p), drop [item name]\n";
+                std::cout << "Items: pick up (or p), drop [number or item name]\n";
                 std::cout << "Combat: attack (or a)\n";
                 std::cout << "Information: look (or l), inventory (or i)\n";
                 std::cout << "Game: exit, quit\n";
@@ -89,8 +98,17 @@ int main() {
                 continue;
             }
 
-            std::string commandResult = game.processCommand(playerCommand);
-            std::cout << commandResult << "\n\n";
+            CommandResult commandResult = game.execute(playerCommand);
+
+            if (commandResult.status == CommandStatus::NeedsChoice) {
+                // Ask for the missing argument and resend the command with it
+                std::cout << "\n" << TextRenderer::render(commandResult, game) << "\n> ";
+                std::string choice;
+                if (!std::getline(std::cin, choice)) break;
+                std::string verb = playerCommand.substr(0, playerCommand.find(' '));
+                commandResult = game.execute(verb + " " + (choice.empty() ? "0" : choice));
+            }
+            std::cout << TextRenderer::render(commandResult, game) << "\n\n";
 
             if (!game.isGameRunning()) break;
 
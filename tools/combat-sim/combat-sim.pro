@@ -0,0 +1,10 @@
+QT = core
+
+CONFIG += c++17 cmdline release
+TARGET = combat-sim
+
+# Simulator links against the same engine sources as the game
+include(../../src/core.pri)
+
+SOURCES += \
+    main.cpp
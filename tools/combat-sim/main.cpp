@@ -0,0 +1,92 @@
+/**
+ * @file main.cpp
+ * @brief Balance report: simulates every race/loadout/time-of-day matchup
+ */
+
+#include "CombatSimulator.h"
+#include "CombatSolver.h"
+#include "ItemCatalog.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Loadouts every race is tried with
+ * @param race Race to equip
+ * @return std::vector<CombatLoadout> Preset loadouts
+ */
+std::vector<CombatLoadout> presetLoadouts(Race race) {
+    return {
+        {race, {}},
+        {race, {ItemCatalog::DAGGER, ItemCatalog::LEATHER_ARMOUR, ItemCatalog::SMALL_SHIELD}},
+        {race, {ItemCatalog::SWORD, ItemCatalog::PLATE_ARMOUR, ItemCatalog::LARGE_SHIELD}},
+        {race, {ItemCatalog::RING_OF_LIFE, ItemCatalog::RING_OF_STRENGTH}},
+    };
+}
+
+} // namespace
+
+/**
+ * @brief Main function - prints the matchup matrix
+ * @return Exit status (0 for success, 1 for error)
+ *
+ * Usage: combat-sim [duels per matchup] [seed] [threads]
+ * Each player loadout fights each unequipped enemy race by day and by night.
+ * The exact win rate from CombatSolver is printed next to the sampled one.
+ */
+int main(int argc, char* argv[]) {
+    std::uint64_t duels = 20000;
+    std::uint64_t seed = 1;
+    unsigned int threads = 0;
+    try {
+        if (argc > 1) duels = std::stoull(argv[1]);
+        if (argc > 2) seed = std::stoull(argv[2]);
+        if (argc > 3) threads = static_cast<unsigned int>(std::stoul(argv[3]));
+    } catch (const std::exception&) {
+        std::cerr << "Usage: combat-sim [duels per matchup] [seed] [threads]\n";
+        return 1;
+    }
+
+    const Race races[] = {Race::Human, Race::Elf, Race::Dwarf, Race::Hobbit, Race::Orc};
+    CombatSimulator simulator(seed, threads);
+    CombatSolver solver;
+
+    std::cout << std::left << std::setw(44) << "Player" << std::setw(8) << "Enemy"
+              << std::setw(7) << "Time" << std::right << std::setw(9) << "Win %" << std::setw(9) << "Exact %"
+              << std::setw(10) << "Rounds" << std::setw(9) << "Gold" << std::setw(8) << "Draws" << "\n";
+
+    std::uint64_t totalRounds = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (Race playerRace : races) {
+        for (const CombatLoadout& player : presetLoadouts(playerRace)) {
+            for (Race enemyRace : races) {
+                CombatLoadout enemy = {enemyRace, {}};
+                for (bool isDaytime : {true, false}) {
+                    CombatSimulator::Result result = simulator.run(player, enemy, isDaytime, duels);
+                    CombatSolver::Outcome exact = solver.solve(player, enemy, isDaytime);
+                    totalRounds += result.totalRounds;
+
+                    std::cout << std::left << std::setw(44) << player.describe()
+                              << std::setw(8) << enemy.describe()
+                              << std::setw(7) << (isDaytime ? "day" : "night") << std::right
+                              << std::fixed << std::setprecision(2)
+                              << std::setw(9) << result.winRate() * 100.0
+                              << std::setw(9) << exact.winProbability * 100.0
+                              << std::setw(10) << result.meanRoundsToKill()
+                              << std::setw(9) << result.meanGold()
+                              << std::setw(8) << result.draws << "\n";
+                }
+            }
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "\n" << totalRounds << " combat rounds in " << std::setprecision(3) << seconds
+              << " s (" << std::setprecision(1) << totalRounds / seconds / 1e6 << " M rounds/s)\n";
+    return 0;
+}
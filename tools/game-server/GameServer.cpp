@@ -0,0 +1,392 @@
+/**
+ * @file GameServer.cpp
+ * @brief Implementation of GameServer class
+ */
+
+#include "GameServer.h"
+#include "TextRenderer.h"
+
+#ifndef __linux__
+#error "game-server needs Linux (epoll, eventfd, EPOLLEXCLUSIVE)"
+#endif
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <charconv>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int MAX_EVENTS = 256;
+constexpr int ACCEPT_BATCH = 64;        // Leave the rest of a burst to other workers
+constexpr std::size_t MAX_LINE = 4096;  // Longer lines close the connection
+constexpr std::size_t MAX_OUTPUT = 64 * 1024;          // More unsent replies pause reading
+constexpr std::size_t HARD_OUTPUT_LIMIT = 1024 * 1024; // More unsent replies close the connection
+
+std::runtime_error systemError(const std::string& what) {
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+void appendNumber(std::string& out, long value) {
+    char buffer[24];
+    auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+    out.append(buffer, end);
+}
+
+} // namespace
+
+GameServer::GameServer(const ServerConfig& config) : config(config) {
+    if (!config.worldPath.empty()) {
+        world = WorldFile::open(config.worldPath);
+    }
+
+    if (config.port > 0) {
+        listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd < 0) throw systemError("socket");
+        int one = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<std::uint16_t>(config.port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            close(listenFd);
+            throw systemError("bind 127.0.0.1:" + std::to_string(config.port));
+        }
+    } else {
+        listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd < 0) throw systemError("socket");
+
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (config.unixPath.size() >= sizeof(address.sun_path)) {
+            close(listenFd);
+            throw std::runtime_error("socket path too long: " + config.unixPath);
+        }
+        std::strcpy(address.sun_path, config.unixPath.c_str());
+        unlink(config.unixPath.c_str());
+        if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            close(listenFd);
+            throw systemError("bind " + config.unixPath);
+        }
+    }
+
+    if (listen(listenFd, SOMAXCONN) < 0) {
+        close(listenFd);
+        throw systemError("listen");
+    }
+
+    stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (stopFd < 0) {
+        close(listenFd);
+        throw systemError("eventfd");
+    }
+}
+
+GameServer::~GameServer() {
+    stop();
+    for (std::thread& thread : threads) {
+        if (thread.joinable()) thread.join();
+    }
+    for (auto& worker : workers) {
+        for (auto& entry : worker->sessions) {
+            close(entry.first);
+        }
+        if (worker->epollFd >= 0) close(worker->epollFd);
+    }
+    close(stopFd);
+    close(listenFd);
+    if (config.port == 0) unlink(config.unixPath.c_str());
+}
+
+void GameServer::run() {
+    unsigned int count = config.workers ? config.workers : std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int i = 0; i < count; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        if (worker->epollFd < 0) throw systemError("epoll_create1");
+
+        // Each connection wakes exactly one worker
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLEXCLUSIVE;
+        event.data.fd = listenFd;
+        if (epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, listenFd, &event) < 0) throw systemError("epoll_ctl listen");
+
+        // The stop event is never read, so it wakes every worker
+        event.events = EPOLLIN;
+        event.data.fd = stopFd;
+        if (epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, stopFd, &event) < 0) throw systemError("epoll_ctl stop");
+
+        workers.push_back(std::move(worker));
+    }
+
+    const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < count; ++i) {
+        threads.emplace_back(&GameServer::workerLoop, this, std::ref(*workers[i]));
+
+        // One worker per core keeps each shard's sessions in that core's cache
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(i % cores, &cpus);
+        pthread_setaffinity_np(threads.back().native_handle(), sizeof(cpus), &cpus);
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void GameServer::stop() {
+    const std::uint64_t one = 1;
+    ssize_t written = write(stopFd, &one, sizeof(one));
+    (void)written;
+}
+
+void GameServer::workerLoop(Worker& worker) {
+    epoll_event events[MAX_EVENTS];
+
+    while (true) {
+        int ready = epoll_wait(worker.epollFd, events, MAX_EVENTS, -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+
+        for (int i = 0; i < ready; ++i) {
+            const int fd = events[i].data.fd;
+            if (fd == stopFd) return;
+            if (fd == listenFd) {
+                acceptClients(worker);
+                continue;
+            }
+
+            auto found = worker.sessions.find(fd);
+            if (found == worker.sessions.end()) continue;
+
+            bool open = !(events[i].events & (EPOLLERR | EPOLLHUP));
+            try {
+                if (open && (events[i].events & EPOLLIN)) open = readClient(worker, fd, found->second);
+                if (open && (events[i].events & EPOLLOUT)) open = flushClient(worker, fd, found->second);
+            } catch (const std::exception&) {
+                // A failing session (journal write error, out of memory)
+                // costs only its own connection, never the whole server
+                open = false;
+            }
+            if (!open) closeClient(worker, fd);
+        }
+    }
+}
+
+void GameServer::acceptClients(Worker& worker) {
+    for (int accepted = 0; accepted < ACCEPT_BATCH; ++accepted) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return; // EAGAIN: backlog drained; EMFILE and friends: retry on the next wake
+
+        if (config.port > 0) {
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.fd = fd;
+        if (epoll_ctl(worker.epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            continue;
+        }
+        Session session;
+        session.watched = event.events;
+        worker.sessions.emplace(fd, std::move(session));
+    }
+}
+
+bool GameServer::readClient(Worker& worker, int fd, Session& session) {
+    char buffer[4096];
+    bool endOfInput = false;
+    // Stop reading once MAX_OUTPUT of replies are waiting: the client's
+    // further lines stay in the socket until flushClient() drains them
+    while (session.output.size() - session.outputSent <= MAX_OUTPUT) {
+        ssize_t received = read(fd, buffer, sizeof(buffer));
+        if (received == 0) {
+            // Client finished sending: still answer what it sent
+            endOfInput = true;
+            break;
+        }
+        if (received < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            if (errno == EINTR) continue;
+            return false;
+        }
+        session.input.append(buffer, static_cast<std::size_t>(received));
+
+        // Answer complete lines as each chunk arrives, so a client streaming
+        // bytes without a newline is cut off at MAX_LINE. Lines held back by
+        // the output cap are complete, so they do not count towards it
+        answerLines(session);
+        if (session.output.size() - session.outputSent <= MAX_OUTPUT && session.input.size() > MAX_LINE) {
+            return false;
+        }
+    }
+
+    return flushClient(worker, fd, session) && !endOfInput;
+}
+
+bool GameServer::flushClient(Worker& worker, int fd, Session& session) {
+    std::size_t pending;
+    while (true) {
+        while (session.outputSent < session.output.size()) {
+            ssize_t sent = send(fd, session.output.data() + session.outputSent,
+                                session.output.size() - session.outputSent, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+                break; // Socket buffer full: finish when it drains
+            }
+            session.outputSent += static_cast<std::size_t>(sent);
+        }
+
+        if (session.outputSent == session.output.size()) {
+            session.output.clear();
+            session.outputSent = 0;
+        } else if (session.outputSent >= MAX_OUTPUT) {
+            // Drop what was written so a slow reader cannot grow the buffer
+            session.output.erase(0, session.outputSent);
+            session.outputSent = 0;
+        }
+
+        // Back under the cap: answer the lines held back while it was
+        // exceeded, then try to send their replies too
+        pending = session.output.size() - session.outputSent;
+        if (pending > MAX_OUTPUT || session.input.find('\n') == std::string::npos) break;
+        answerLines(session);
+    }
+    if (pending > HARD_OUTPUT_LIMIT) return false;
+
+    // Read only while under the cap, and wait for the socket to drain while
+    // replies are pending. EPOLLRDHUP goes with EPOLLIN: a paused session
+    // must not be woken over and over by a client that stopped sending
+    std::uint32_t wanted = 0;
+    if (pending <= MAX_OUTPUT) wanted |= EPOLLIN | EPOLLRDHUP;
+    if (pending > 0) wanted |= EPOLLOUT;
+    if (wanted != session.watched) {
+        epoll_event event{};
+        event.events = wanted;
+        event.data.fd = fd;
+        epoll_ctl(worker.epollFd, EPOLL_CTL_MOD, fd, &event);
+        session.watched = wanted;
+    }
+    return true;
+}
+
+/**
+ * @brief Answer the complete lines a session has received, in order
+ * @param session Session whose input to consume
+ *
+ * Stops early once MAX_OUTPUT of replies are waiting; the remaining lines
+ * stay in the session's input until flushClient() has drained the output.
+ */
+void GameServer::answerLines(Session& session) {
+    std::size_t start = 0;
+    std::size_t newline;
+    while (session.output.size() - session.outputSent <= MAX_OUTPUT &&
+           (newline = session.input.find('\n', start)) != std::string::npos) {
+        std::size_t end = newline;
+        if (end > start && session.input[end - 1] == '\r') --end;
+        handleLine(session, std::string_view(session.input).substr(start, end - start));
+        start = newline + 1;
+    }
+    session.input.erase(0, start);
+}
+
+/**
+ * @brief Answer one request line
+ * @param session Session the line arrived on
+ * @param line Request without its line ending
+ *
+ * Pseudo-code:
+ * 1. "start <race> [seed]" creates a fresh game for the session,
+ *    journaled when a journal directory is configured
+ * 2. Other lines need a game and go to Game::execute()
+ * 3. Append the reply as event codes, or as rendered text in text mode
+ */
+void GameServer::handleLine(Session& session, std::string_view line) {
+    std::string& out = session.output;
+
+    if (line.substr(0, 6) == "start " || line == "start") {
+        std::istringstream words(std::string(line.substr(5)));
+        std::string race = "human";
+        std::uint64_t seed = 0;
+        words >> race;
+        const bool seeded = static_cast<bool>(words >> seed);
+
+        session.game = seeded ? std::make_unique<Game>(seed) : std::make_unique<Game>();
+        if (world) {
+            session.game->initializeGame(world, race, "Player");
+        } else {
+            session.game->initializeGame(config.boardWidth, config.boardHeight, race, "Player");
+            if (!config.journalDir.empty()) {
+                // Journals are finished when the session ends or starts over
+                const std::uint64_t number = journalsStarted.fetch_add(1, std::memory_order_relaxed);
+                try {
+                    session.game->recordTo(config.journalDir + "/session-" + std::to_string(number) + ".jrnl");
+                } catch (const std::exception&) {
+                    session.game.reset();
+                    out += config.text ? "error cannot create journal\n.\n" : "error cannot create journal\n";
+                    return;
+                }
+            }
+        }
+
+        if (config.text) {
+            out += session.game->getGameStatus();
+            out += "\n.\n";
+        } else {
+            out += "0 0\n";
+        }
+        return;
+    }
+
+    if (!session.game) {
+        out += config.text ? "error start a game first\n.\n" : "error start a game first\n";
+        return;
+    }
+
+    const CommandResult result = session.game->execute(line);
+
+    if (config.text) {
+        out += TextRenderer::render(result, *session.game);
+        out += "\n.\n";
+        return;
+    }
+
+    appendNumber(out, static_cast<long>(result.status));
+    out += result.gameOver ? " 1" : " 0";
+    for (const CommandEvent& event : result) {
+        out += ' ';
+        appendNumber(out, static_cast<long>(event.code));
+        out += ':';
+        appendNumber(out, event.subject);
+        out += ':';
+        appendNumber(out, event.value);
+    }
+    out += '\n';
+}
+
+void GameServer::closeClient(Worker& worker, int fd) {
+    epoll_ctl(worker.epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    worker.sessions.erase(fd);
+}
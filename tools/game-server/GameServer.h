@@ -0,0 +1,125 @@
+/**
+ * @file GameServer.h
+ * @brief epoll-based server hosting many Game sessions in one process (Linux)
+ */
+
+#ifndef GAMESERVER_H
+#define GAMESERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Game.h"
+
+/**
+ * @struct ServerConfig
+ * @brief Where to listen and how to run the sessions
+ */
+struct ServerConfig {
+    std::string unixPath;   ///< Unix socket path; used when port is 0
+    std::string worldPath;  ///< Pre-built world file shared by every session (optional)
+    std::string journalDir; ///< Directory for per-session command journals (optional)
+    int port = 0;           ///< TCP port on 127.0.0.1, or 0 for the Unix socket
+    unsigned int workers = 0; ///< Worker threads (0 = hardware concurrency)
+    bool text = false;      ///< Send rendered text instead of event codes
+    int boardWidth = 15;
+    int boardHeight = 15;
+};
+
+/**
+ * @class GameServer
+ * @brief Line-oriented game service sharded across worker threads
+ *
+ * Every worker runs its own epoll loop and owns the sessions it accepted,
+ * so a session is only ever touched by one thread and no locks are
+ * needed. The listening socket is registered in every worker's epoll set
+ * with EPOLLEXCLUSIVE, so each new connection wakes a single worker,
+ * which then keeps it for its lifetime.
+ *
+ * Protocol (one request per line):
+ * - "start <race> [seed]" creates the session's game (on the shared world
+ *   file if one was given, in which case the seed is ignored). With a
+ *   journal directory, games on generated boards record their commands
+ *   there for replay.
+ * - Any other line is passed to Game::execute().
+ * - Each reply is one line: "<status> <gameOver>" followed by
+ *   "<code>:<subject>:<value>" for each event (see CommandResult.h).
+ *   In text mode the reply is the rendered text ended by a "." line.
+ * - Errors reply "error <reason>".
+ *
+ * A client that sends faster than it reads its replies is throttled:
+ * once 64 KiB of replies are waiting, the server stops reading from it
+ * until they drain, and a session whose replies still pass 1 MiB is closed.
+ */
+class GameServer {
+public:
+    /**
+     * @brief Constructor for GameServer - creates the listening socket
+     * @param config Listening address and session settings
+     * @throws std::runtime_error if the socket cannot be created
+     */
+    explicit GameServer(const ServerConfig& config);
+
+    /**
+     * @brief Destructor - stops the workers and closes every socket
+     */
+    ~GameServer();
+
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    /**
+     * @brief Start the workers and block until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Ask every worker to finish (safe from a signal handler)
+     */
+    void stop();
+
+private:
+    /**
+     * @struct Session
+     * @brief One connected client and its game
+     */
+    struct Session {
+        std::unique_ptr<Game> game;
+        std::string input;           ///< Bytes received but not yet a full line
+        std::string output;          ///< Replies not yet written
+        std::size_t outputSent = 0;  ///< Bytes of output already written
+        std::uint32_t watched = 0;   ///< epoll events currently registered
+    };
+
+    /**
+     * @struct Worker
+     * @brief Per-thread epoll set and the sessions it owns
+     */
+    struct Worker {
+        int epollFd = -1;
+        std::unordered_map<int, Session> sessions;
+    };
+
+    void workerLoop(Worker& worker);
+    void acceptClients(Worker& worker);
+    bool readClient(Worker& worker, int fd, Session& session);
+    bool flushClient(Worker& worker, int fd, Session& session);
+    void answerLines(Session& session);
+    void handleLine(Session& session, std::string_view line);
+    void closeClient(Worker& worker, int fd);
+
+    ServerConfig config;
+    std::shared_ptr<const WorldFile> world; // Mapped once, shared read-only by all sessions
+    int listenFd = -1;
+    int stopFd = -1;
+    std::atomic<std::uint64_t> journalsStarted{0};
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+};
+
+#endif // GAMESERVER_H
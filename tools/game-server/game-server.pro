@@ -0,0 +1,14 @@
+QT = core
+
+CONFIG += c++17 cmdline release thread
+TARGET = game-server
+
+# Linux only: the event loop uses epoll
+include(../../src/core.pri)
+
+SOURCES += \
+    main.cpp \
+    GameServer.cpp
+
+HEADERS += \
+    GameServer.h
@@ -0,0 +1,84 @@
+/**
+ * @file main.cpp
+ * @brief Hosts many game sessions behind a Unix or TCP socket
+ */
+
+#include "GameServer.h"
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+
+namespace {
+
+GameServer* runningServer = nullptr;
+
+void handleSignal(int) {
+    if (runningServer) runningServer->stop();
+}
+
+/**
+ * @brief Raise the open file limit so every session can have a socket
+ */
+void raiseFileLimit() {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Main function - runs the server until SIGINT or SIGTERM
+ * @return Exit status (0 for success, 1 for error)
+ *
+ * Usage: game-server [--unix PATH | --port N] [--workers N] [--world FILE] [--journal DIR] [--text]
+ */
+int main(int argc, char* argv[]) {
+    ServerConfig config;
+    config.unixPath = "/tmp/shadows-game.sock";
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option == "--unix" && i + 1 < argc) {
+                config.unixPath = argv[++i];
+            } else if (option == "--port" && i + 1 < argc) {
+                config.port = std::stoi(argv[++i]);
+            } else if (option == "--workers" && i + 1 < argc) {
+                config.workers = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else if (option == "--world" && i + 1 < argc) {
+                config.worldPath = argv[++i];
+            } else if (option == "--journal" && i + 1 < argc) {
+                config.journalDir = argv[++i];
+            } else if (option == "--text") {
+                config.text = true;
+            } else {
+                throw std::invalid_argument(option);
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Usage: game-server [--unix PATH | --port N] [--workers N] [--world FILE] [--journal DIR] [--text]\n";
+        return 1;
+    }
+
+    raiseFileLimit();
+
+    try {
+        GameServer server(config);
+        runningServer = &server;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        std::cout << "Listening on " << (config.port > 0 ? "127.0.0.1:" + std::to_string(config.port) : config.unixPath)
+                  << (config.text ? " (text replies)" : "") << std::endl;
+        server.run();
+        runningServer = nullptr;
+    } catch (const std::exception& error) {
+        std::cerr << "game-server: " << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
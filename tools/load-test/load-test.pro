@@ -0,0 +1,8 @@
+QT = core
+
+CONFIG += c++17 cmdline release thread
+TARGET = load-test
+
+# Linux only: drives thousands of sockets with epoll
+SOURCES += \
+    main.cpp
@@ -0,0 +1,429 @@
+/**
+ * @file main.cpp
+ * @brief Load generator for game-server: many concurrent sessions, latency percentiles
+ */
+
+#ifndef __linux__
+#error "load-test needs Linux (epoll)"
+#endif
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @struct Options
+ * @brief Command-line settings
+ */
+struct Options {
+    std::string unixPath = "/tmp/shadows-game.sock";
+    int port = 0;
+    std::size_t sessions = 10000;
+    std::size_t commands = 100;
+    unsigned int threads = 1;
+    bool noRead = false;  ///< Send every command at once and never read a reply
+    long serverPid = 0;   ///< Report this process's resident memory when set
+};
+
+/**
+ * @struct Connection
+ * @brief One simulated player: sends a command, waits for the reply, repeats
+ */
+struct Connection {
+    int fd = -1;
+    std::size_t remaining = 0;  ///< Commands still to send
+    bool started = false;       ///< "start" reply received
+    std::uint64_t state = 0;    ///< Picks the next command
+    Clock::time_point sentAt;
+    std::string input;
+};
+
+/**
+ * @struct ThreadStats
+ * @brief Results gathered by one driver thread
+ */
+struct ThreadStats {
+    std::vector<std::uint32_t> latencies; ///< Microseconds per command
+    std::size_t errors = 0;
+    std::uint64_t bytesSent = 0;   ///< Request bytes the server accepted (--no-read)
+    std::size_t stalled = 0;       ///< Sessions the server stopped reading (--no-read)
+    std::size_t dropped = 0;       ///< Sessions the server closed (--no-read)
+};
+
+// Bot-like mix: mostly movement and looking around, some fighting and looting
+const char* const COMMANDS[] = {"n\n", "s\n", "e\n", "w\n", "n\n", "e\n", "look\n", "a\n", "p\n", "i\n"};
+constexpr std::size_t COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+const char* const RACES[] = {"human", "elf", "dwarf", "hobbit", "orc"};
+
+void raiseFileLimit() {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+int connectToServer(const Options& options) {
+    int fd;
+    int result;
+    if (options.port > 0) {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) throw std::runtime_error(std::string("socket: ") + std::strerror(errno));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<std::uint16_t>(options.port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        result = connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    } else {
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) throw std::runtime_error(std::string("socket: ") + std::strerror(errno));
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, options.unixPath.c_str(), sizeof(address.sun_path) - 1);
+        result = connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    }
+    if (result < 0) {
+        close(fd);
+        throw std::runtime_error(std::string("connect: ") + std::strerror(errno));
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+bool sendLine(Connection& connection, const char* line) {
+    connection.sentAt = Clock::now();
+    // Requests are a few bytes; a fresh socket buffer always takes them whole
+    return send(connection.fd, line, std::strlen(line), MSG_NOSIGNAL) == static_cast<ssize_t>(std::strlen(line));
+}
+
+const char* nextCommand(Connection& connection) {
+    connection.state = connection.state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return COMMANDS[(connection.state >> 33) % COMMAND_COUNT];
+}
+
+/**
+ * @brief Drive a share of the connections until all have sent their commands
+ * @param connections Connections owned by this thread
+ * @param stats Output latencies and error count
+ *
+ * Pseudo-code:
+ * 1. Send "start <race> <seed>" on every connection
+ * 2. On each reply, record the round-trip time and send the next command
+ * 3. Close a connection after its last reply
+ */
+void drive(std::vector<Connection>& connections, ThreadStats& stats) {
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    std::size_t open = connections.size();
+
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        Connection& connection = connections[i];
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = i;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, connection.fd, &event);
+
+        std::string start = "start " + std::string(RACES[connection.state % 5]) + " " +
+                            std::to_string(connection.state) + "\n";
+        if (!sendLine(connection, start.c_str())) ++stats.errors;
+    }
+
+    epoll_event events[256];
+    char buffer[4096];
+    while (open > 0) {
+        int ready = epoll_wait(epollFd, events, 256, -1);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready < 0) break;
+
+        for (int e = 0; e < ready; ++e) {
+            Connection& connection = connections[events[e].data.u64];
+            if (connection.fd < 0) continue;
+
+            bool closed = false;
+            while (true) {
+                ssize_t received = read(connection.fd, buffer, sizeof(buffer));
+                if (received > 0) {
+                    connection.input.append(buffer, static_cast<std::size_t>(received));
+                    continue;
+                }
+                closed = received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+                if (!closed && errno == EINTR) continue;
+                break;
+            }
+
+            std::size_t newline;
+            while (!closed && (newline = connection.input.find('\n')) != std::string::npos) {
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - connection.sentAt);
+                if (connection.input.compare(0, 5, "error") == 0) ++stats.errors;
+                connection.input.erase(0, newline + 1);
+
+                if (connection.started) {
+                    stats.latencies.push_back(static_cast<std::uint32_t>(elapsed.count()));
+                }
+                connection.started = true;
+
+                if (connection.remaining == 0) {
+                    closed = true;
+                    break;
+                }
+                --connection.remaining;
+                if (!sendLine(connection, nextCommand(connection))) {
+                    ++stats.errors;
+                    closed = true;
+                }
+            }
+
+            if (closed) {
+                if (connection.remaining > 0) stats.errors += connection.remaining;
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+                close(connection.fd);
+                connection.fd = -1;
+                --open;
+            }
+        }
+    }
+    close(epollFd);
+}
+
+/**
+ * @brief Pipeline every command on each connection without reading replies
+ * @param connections Connections owned by this thread
+ * @param commands Commands to send per connection after "start"
+ * @param stats Output bytes accepted and how each session ended
+ *
+ * Pseudo-code:
+ * 1. Queue "start" and all commands for every connection
+ * 2. Write whenever a socket has room, never reading the replies
+ * 3. Stop once a second passes with no socket taking more bytes; the
+ *    sessions with requests left are the ones the server stopped reading
+ */
+void flood(std::vector<Connection>& connections, std::size_t commands, ThreadStats& stats) {
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    std::vector<std::string> queued(connections.size());
+    std::vector<std::size_t> written(connections.size(), 0);
+    std::size_t open = connections.size();
+
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        Connection& connection = connections[i];
+        queued[i] = "start " + std::string(RACES[connection.state % 5]) + " " +
+                    std::to_string(connection.state) + "\n";
+        for (std::size_t c = 0; c < commands; ++c) {
+            queued[i] += nextCommand(connection);
+        }
+
+        epoll_event event{};
+        event.events = EPOLLOUT;
+        event.data.u64 = i;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, connection.fd, &event);
+    }
+
+    epoll_event events[256];
+    while (open > 0) {
+        int ready = epoll_wait(epollFd, events, 256, 1000);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready <= 0) break; // Nothing drained for a second: the server is holding back
+
+        for (int e = 0; e < ready; ++e) {
+            const std::size_t i = events[e].data.u64;
+            Connection& connection = connections[i];
+            if (connection.fd < 0) continue;
+
+            bool finished = false;
+            while (written[i] < queued[i].size()) {
+                ssize_t sent = send(connection.fd, queued[i].data() + written[i], queued[i].size() - written[i],
+                                    MSG_NOSIGNAL);
+                if (sent < 0) {
+                    if (errno == EINTR) continue;
+                    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                        ++stats.dropped;
+                        finished = true;
+                    }
+                    break;
+                }
+                written[i] += static_cast<std::size_t>(sent);
+                stats.bytesSent += static_cast<std::uint64_t>(sent);
+            }
+            if (written[i] == queued[i].size()) finished = true;
+
+            if (finished) {
+                // Keep a fully sent session connected, just stop watching it
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+                if (written[i] < queued[i].size()) {
+                    close(connection.fd);
+                    connection.fd = -1;
+                }
+                --open;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+        if (connections[i].fd >= 0 && written[i] < queued[i].size()) ++stats.stalled;
+    }
+    close(epollFd);
+}
+
+/**
+ * @brief Read a process's resident memory from /proc
+ * @param pid Process id
+ * @return long Resident set size in KiB, or -1 if unavailable
+ */
+long residentKiB(long pid) {
+    std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) return std::stol(line.substr(6));
+    }
+    return -1;
+}
+
+double percentile(const std::vector<std::uint32_t>& sorted, double fraction) {
+    if (sorted.empty()) return 0.0;
+    std::size_t index = static_cast<std::size_t>(fraction * (sorted.size() - 1));
+    return sorted[index];
+}
+
+} // namespace
+
+/**
+ * @brief Main function - opens every session, runs the traffic, prints latency
+ * @return Exit status (0 for success, 1 for error)
+ *
+ * Usage: load-test [--unix PATH | --port N] [--sessions N] [--commands N] [--threads N]
+ *                  [--no-read] [--server-pid PID]
+ * All sessions are connected before any command is sent, so the server
+ * holds every session open at once. With --no-read every session sends
+ * all its commands at once and never reads a reply, which shows how much
+ * the server buffers for clients that do not keep up; --server-pid then
+ * reports the server's resident memory before and after.
+ */
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option == "--unix" && i + 1 < argc) {
+                options.unixPath = argv[++i];
+            } else if (option == "--port" && i + 1 < argc) {
+                options.port = std::stoi(argv[++i]);
+            } else if (option == "--sessions" && i + 1 < argc) {
+                options.sessions = std::stoul(argv[++i]);
+            } else if (option == "--commands" && i + 1 < argc) {
+                options.commands = std::stoul(argv[++i]);
+            } else if (option == "--threads" && i + 1 < argc) {
+                options.threads = std::max(1u, static_cast<unsigned int>(std::stoul(argv[++i])));
+            } else if (option == "--no-read") {
+                options.noRead = true;
+            } else if (option == "--server-pid" && i + 1 < argc) {
+                options.serverPid = std::stol(argv[++i]);
+            } else {
+                throw std::invalid_argument(option);
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << "Usage: load-test [--unix PATH | --port N] [--sessions N] [--commands N] [--threads N]\n"
+                     "                 [--no-read] [--server-pid PID]\n";
+        return 1;
+    }
+
+    raiseFileLimit();
+
+    // Open every session first
+    std::vector<std::vector<Connection>> shards(options.threads);
+    try {
+        for (std::size_t i = 0; i < options.sessions; ++i) {
+            Connection connection;
+            connection.fd = connectToServer(options);
+            connection.remaining = options.commands;
+            connection.state = i + 1;
+            shards[i % options.threads].push_back(std::move(connection));
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "load-test: " << error.what() << std::endl;
+        return 1;
+    }
+    std::cout << "Connected " << options.sessions << " sessions\n";
+
+    if (options.noRead) {
+        const long before = options.serverPid ? residentKiB(options.serverPid) : -1;
+        std::vector<ThreadStats> stats(options.threads);
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < options.threads; ++t) {
+            threads.emplace_back(flood, std::ref(shards[t]), options.commands, std::ref(stats[t]));
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        ThreadStats total;
+        for (const ThreadStats& shard : stats) {
+            total.bytesSent += shard.bytesSent;
+            total.stalled += shard.stalled;
+            total.dropped += shard.dropped;
+        }
+        std::cout << "Sent " << total.bytesSent / 1024 << " KiB of requests without reading; "
+                  << total.stalled << " sessions stalled, " << total.dropped << " closed by the server\n";
+        if (options.serverPid) {
+            std::cout << "Server resident memory: " << before << " KiB before, "
+                      << residentKiB(options.serverPid) << " KiB while stalled\n";
+        }
+        for (std::vector<Connection>& shard : shards) {
+            for (Connection& connection : shard) {
+                if (connection.fd >= 0) close(connection.fd);
+            }
+        }
+        return 0;
+    }
+
+    std::vector<ThreadStats> stats(options.threads);
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < options.threads; ++t) {
+        threads.emplace_back(drive, std::ref(shards[t]), std::ref(stats[t]));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<std::uint32_t> latencies;
+    std::size_t errors = 0;
+    for (const ThreadStats& shard : stats) {
+        latencies.insert(latencies.end(), shard.latencies.begin(), shard.latencies.end());
+        errors += shard.errors;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::fixed << std::setprecision(0)
+              << "Commands: " << latencies.size() << " in " << std::setprecision(2) << seconds << " s ("
+              << std::setprecision(0) << latencies.size() / seconds << " commands/s), errors: " << errors << "\n"
+              << "Latency (us): p50 " << percentile(latencies, 0.50)
+              << "  p90 " << percentile(latencies, 0.90)
+              << "  p99 " << percentile(latencies, 0.99)
+              << "  p99.9 " << percentile(latencies, 0.999)
+              << "  max " << (latencies.empty() ? 0.0 : latencies.back()) << "\n";
+    return errors == 0 ? 0 : 1;
+}
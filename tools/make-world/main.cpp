@@ -0,0 +1,43 @@
+/**
+ * @file main.cpp
+ * @brief Generates a board once and writes it as a world file for WorldFile
+ */
+
+#include "Game.h"
+#include "GameSnapshot.h"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Main function - generates and saves a world
+ * @return Exit status (0 for success, 1 for error)
+ *
+ * Usage: make-world <file> <width> <height> [seed]
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Usage: make-world <file> <width> <height> [seed]\n";
+        return 1;
+    }
+
+    try {
+        const std::string path = argv[1];
+        const int width = std::stoi(argv[2]);
+        const int height = std::stoi(argv[3]);
+        const std::uint64_t seed = argc > 4 ? std::stoull(argv[4]) : 1;
+
+        auto start = std::chrono::steady_clock::now();
+        Game game(seed);
+        game.initializeGame(width, height, "human", "World");
+        GameSnapshot::save(game, path);
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Wrote " << width << "x" << height << " world (seed " << seed << ") to " << path
+                  << " in " << elapsed.count() << " s\n";
+    } catch (const std::exception& error) {
+        std::cerr << "make-world: " << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
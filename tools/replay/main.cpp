@@ -0,0 +1,52 @@
+/**
+ * @file main.cpp
+ * @brief Re-executes command journals and verifies their state hashes
+ */
+
+#include "CommandJournal.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Main function - replays each journal named on the command line
+ * @return Exit status (0 if every journal replayed identically, 1 otherwise)
+ *
+ * Usage: replay <journal>...
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: replay <journal>...\n";
+        return 1;
+    }
+
+    bool allMatched = true;
+    for (int i = 1; i < argc; ++i) {
+        const std::string path = argv[i];
+        try {
+            auto start = std::chrono::steady_clock::now();
+            const CommandJournal::ReplayResult result = CommandJournal::replay(path);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            const bool matched = result.startMatched && result.mismatches == 0 && result.checkpoints > 0;
+            allMatched = allMatched && matched;
+            std::cout << path << ": " << result.commands << " commands in " << std::fixed << std::setprecision(3)
+                      << elapsed.count() * 1000.0 << " ms, state " << std::hex << std::setw(16)
+                      << std::setfill('0') << result.finalHash << std::dec << std::setfill(' ') << " - ";
+            if (!result.startMatched) {
+                std::cout << "MISMATCH (seeds do not rebuild the recorded start)\n";
+            } else if (result.checkpoints == 0) {
+                std::cout << "UNVERIFIED (journal has no final hash)\n";
+            } else if (result.mismatches > 0) {
+                std::cout << "MISMATCH (" << result.mismatches << " of " << result.checkpoints << " checkpoints)\n";
+            } else {
+                std::cout << "OK\n";
+            }
+        } catch (const std::exception& error) {
+            std::cerr << "replay: " << path << ": " << error.what() << std::endl;
+            allMatched = false;
+        }
+    }
+    return allMatched ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+QT = core
+
+CONFIG += c++17 cmdline release
+TARGET = replay
+
+# Replays journals with the same engine sources as the game
+include(../../src/core.pri)
+
+SOURCES += \
+    main.cpp